@@ -38,11 +38,17 @@
 #include "gs_tar_const.h"
 #include "bin/elog.h"
 #include "lib/string.h"
+#include "lz4.h"
+
+#include <arpa/inet.h>
 
 #ifdef ENABLE_MOT
 #include "fetchmot.h"
 #endif
 
+/* a CopyData message never exceeds the server side MaxAllocSize */
+#define MAX_COPY_DATA_LEN 0x3fffffff
+
 typedef struct TablespaceListCell {
     struct TablespaceListCell* next;
     char old_dir[MAXPGPATH];
@@ -64,6 +70,7 @@ char *label = "gs_basebackup base backup";
 bool showprogress = false;
 int verbose = 0;
 int compresslevel = 0;
+bool servercompress = false;
 bool includewal = true;
 bool streamwal = true;
 bool fastcheckpoint = false;
@@ -105,6 +112,7 @@ static void progress_report(int tablespacenum, const char* filename);
 
 static void ReceiveTarFile(PGconn *conn, PGresult *res, int rownum);
 static void ReceiveAndUnpackTarFile(PGconn *conn, PGresult *res, int rownum);
+static int DecompressCopyData(char **copybuf, int len);
 static void BaseBackup(void);
 static void backup_dw_file(const char *target_dir);
 
@@ -223,6 +231,7 @@ static void usage(void)
              "                         include required WAL files with specified method\n"));
     printf(_("  -z, --gzip             compress tar output\n"));
     printf(_("  -Z, --compress=0-9     compress tar output with given compression level\n"));
+    printf(_("      --server-compress  let the server LZ4 compress the data it sends\n"));
     printf(_("\nGeneral options:\n"));
     printf(_("  -c, --checkpoint=fast|spread\n"
              "                         set fast or spread checkpointing\n"));
@@ -746,6 +755,9 @@ static void ReceiveTarFile(PGconn *conn, PGresult *res, int rownum)
             pg_log(stderr, _("%s: could not read COPY data: %s"), progname, PQerrorMessage(conn));
             disconnect_and_exit(1);
         }
+        if (servercompress) {
+            r = DecompressCopyData(&copybuf, r);
+        }
 
 #ifdef HAVE_LIBZ
         if (ztarfile != NULL) {
@@ -781,6 +793,55 @@ static void ReceiveTarFile(PGconn *conn, PGresult *res, int rownum)
     }
 }
 
+/*
+ * Undo the per message LZ4 compression of BASE_BACKUP COMPRESS. The payload
+ * is the uncompressed length in network order followed by the compressed
+ * data, or by the raw data if the server could not compress it. Replaces
+ * *copybuf with the uncompressed message and returns its length.
+ */
+static int DecompressCopyData(char **copybuf, int len)
+{
+    uint32 rawlen = 0;
+    errno_t errorno = EOK;
+
+    if (len == 0) {
+        return 0;
+    }
+    if (len < (int)sizeof(uint32)) {
+        pg_log(stderr, _("%s: invalid compressed COPY data length: %d\n"), progname, len);
+        disconnect_and_exit(1);
+    }
+    errorno = memcpy_s(&rawlen, sizeof(uint32), *copybuf, sizeof(uint32));
+    securec_check_c(errorno, "\0", "\0");
+    rawlen = ntohl(rawlen);
+    if (rawlen == 0 || rawlen > MAX_COPY_DATA_LEN) {
+        pg_log(stderr, _("%s: invalid uncompressed COPY data length: %u\n"), progname, rawlen);
+        disconnect_and_exit(1);
+    }
+
+    char *raw = (char *)malloc(rawlen);
+    if (raw == NULL) {
+        pg_log(stderr, _("%s: out of memory\n"), progname);
+        disconnect_and_exit(1);
+    }
+
+    const char *payload = *copybuf + sizeof(uint32);
+    int payloadlen = len - (int)sizeof(uint32);
+    if ((uint32)payloadlen == rawlen) {
+        /* stored as is */
+        errorno = memcpy_s(raw, rawlen, payload, rawlen);
+        securec_check_c(errorno, "\0", "\0");
+    } else if (LZ4_decompress_safe(payload, raw, payloadlen, (int)rawlen) != (int)rawlen) {
+        pg_log(stderr, _("%s: could not decompress COPY data\n"), progname);
+        free(raw);
+        disconnect_and_exit(1);
+    }
+
+    PQfreemem(*copybuf);
+    *copybuf = raw;
+    return (int)rawlen;
+}
+
 /*
  * Retrieve tablespace path, either relocated or original depending on whether
  * -T was passed or not.
@@ -910,6 +971,9 @@ static void ReceiveAndUnpackTarFile(PGconn *conn, PGresult *res, int rownum)
             pg_log(stderr, _("%s: could not read COPY data: %s"), progname, PQerrorMessage(conn));
             disconnect_and_exit(1);
         }
+        if (servercompress) {
+            r = DecompressCopyData(&copybuf, r);
+        }
 
         if (file == NULL) {
             /* new file */
@@ -1169,9 +1233,9 @@ static void BaseBackup(void)
      */
     PQescapeStringConn(conn, escaped_label, label, sizeof(escaped_label), &i);
     rc = snprintf_s(current_path, sizeof(current_path), sizeof(current_path) - 1,
-        "BASE_BACKUP LABEL '%s' %s %s %s %s %s", escaped_label, showprogress ? "PROGRESS" : "",
+        "BASE_BACKUP LABEL '%s' %s %s %s %s %s %s", escaped_label, showprogress ? "PROGRESS" : "",
         includewal && !streamwal ? "WAL" : "", fastcheckpoint ? "FAST" : "", includewal ? "NOWAIT" : "",
-        format == 't' ? "TABLESPACE_MAP" : "");
+        format == 't' ? "TABLESPACE_MAP" : "", servercompress ? "COMPRESS" : "");
     securec_check_ss_c(rc, "", "");
 
     if (PQsendQuery(conn, current_path) == 0) {
@@ -1884,6 +1948,7 @@ static int GsBaseBackup(int argc, char** argv)
                                            {"xlog-method", required_argument, NULL, 'X'},
                                            {"gzip", no_argument, NULL, 'z'},
                                            {"compress", required_argument, NULL, 'Z'},
+                                           {"server-compress", no_argument, NULL, 1},
                                            {"label", required_argument, NULL, 'l'},
                                            {"host", required_argument, NULL, 'h'},
                                            {"port", required_argument, NULL, 'p'},
@@ -1982,6 +2047,9 @@ static int GsBaseBackup(int argc, char** argv)
                     exit(1);
                 }
                 break;
+            case 1:
+                servercompress = true;
+                break;
             case 'c':
                 if (pg_strcasecmp(optarg, "fast") == 0)
                     fastcheckpoint = true;
@@ -126,6 +126,7 @@ extern GlobalNodeDefinition* global_node_definition;
 #endif
 
 #define NAPTIME_PER_SEND_RETRY 100 /* max sleep between two send try (100ms) */
+#define PQ_MAX_DEFERRED_FLUSHES 8    /* max batches whose output a pipelining client waits for */
 #define NAPTIME_PER_SEND 10        /* max sleep before sending next batch of data (10ms) */
 
 void pq_close(int code, Datum arg);
@@ -444,6 +445,7 @@ void pq_init(void)
     t_thrd.libpq_cxt.PqSendPointer = t_thrd.libpq_cxt.PqSendStart = t_thrd.libpq_cxt.PqRecvPointer =
         t_thrd.libpq_cxt.PqRecvLength = 0;
     t_thrd.libpq_cxt.PqCommBusy = false;
+    t_thrd.libpq_cxt.PqDeferredFlushes = 0;
     t_thrd.libpq_cxt.DoingCopyOut = false;
 
     pq_disk_reset_tempfile_contextinfo();
@@ -1156,6 +1158,9 @@ static int pq_recvbuf(void)
         }
     }
 
+    /* the client may be waiting for deferred results before it sends more */
+    pq_flush_deferred();
+
     /* Ensure that we're in blocking mode */
     pq_set_nonblocking(false);
 
@@ -1666,6 +1671,7 @@ static int internal_flush(void)
              * the connection.
              */
             t_thrd.libpq_cxt.PqSendStart = t_thrd.libpq_cxt.PqSendPointer = 0;
+            t_thrd.libpq_cxt.PqDeferredFlushes = 0;
             if ((StreamThreadAmI() == false) && (!t_thrd.proc_cxt.proc_exit_inprogress)) {
                 t_thrd.int_cxt.ClientConnectionLost = 1;
                 InterruptPending = 1;
@@ -1682,6 +1688,7 @@ static int internal_flush(void)
     }
 
     t_thrd.libpq_cxt.PqSendStart = t_thrd.libpq_cxt.PqSendPointer = 0;
+    t_thrd.libpq_cxt.PqDeferredFlushes = 0;
     (void)pgstat_report_waitstatus(oldStatus);
     return 0;
 }
@@ -1796,6 +1803,75 @@ bool pq_is_send_pending(void)
     return (t_thrd.libpq_cxt.PqSendStart < t_thrd.libpq_cxt.PqSendPointer);
 }
 
+/* --------------------------------
+ *		pq_has_pipelined_sync	- does the input buffer already hold a complete
+ *			batch sent ahead by a pipelining client?
+ *
+ *		Walks the complete protocol 3 messages left in the receive buffer and
+ *		returns true if one of them ends a batch (Sync, simple Query, Flush or
+ *		Terminate). In that case we will reach the next flush point without
+ *		reading from the socket, so the caller may leave its output in the
+ *		send buffer and let it go out together with the next batch's results.
+ *		Never reads from the socket.
+ * --------------------------------
+ */
+bool pq_has_pipelined_sync(void)
+{
+    const unsigned char* buf = (const unsigned char*)t_thrd.libpq_cxt.PqRecvBuffer;
+    int pos = t_thrd.libpq_cxt.PqRecvPointer;
+    int end = t_thrd.libpq_cxt.PqRecvLength;
+
+    /* message type byte and 4 bytes length word, the length counts itself */
+    while (end - pos >= 5) {
+        unsigned char msgtype = buf[pos];
+        uint32 len = ((uint32)buf[pos + 1] << 24) | ((uint32)buf[pos + 2] << 16) |
+                     ((uint32)buf[pos + 3] << 8) | (uint32)buf[pos + 4];
+        if (len < 4 || len > (uint32)(end - pos - 1)) {
+            return false;
+        }
+        if (msgtype == 'S' || msgtype == 'Q' || msgtype == 'H' || msgtype == 'X') {
+            return true;
+        }
+        pos += 1 + (int)len;
+    }
+    return false;
+}
+
+/* --------------------------------
+ *		pq_defer_flush	- leave the output of a finished batch in the send
+ *			buffer, if that is safe
+ *
+ *		Returns true if the caller may skip its flush: the client already
+ *		sent the next batch (see pq_has_pipelined_sync), and no more than
+ *		PQ_MAX_DEFERRED_FLUSHES batches are held back. The deferred output is
+ *		flushed by the next flush point, or by pq_flush_deferred() before the
+ *		backend blocks on the socket or on a lock.
+ * --------------------------------
+ */
+bool pq_defer_flush(void)
+{
+    if (t_thrd.libpq_cxt.PqDeferredFlushes >= PQ_MAX_DEFERRED_FLUSHES || !pq_has_pipelined_sync()) {
+        return false;
+    }
+    t_thrd.libpq_cxt.PqDeferredFlushes++;
+    return true;
+}
+
+/* --------------------------------
+ *		pq_flush_deferred	- flush output deferred by pq_defer_flush
+ *
+ *		Called before anything that can block for a long time. The deferred
+ *		output may hold the acknowledgement of a COMMIT that the client (or
+ *		another session of it) is waiting for.
+ * --------------------------------
+ */
+void pq_flush_deferred(void)
+{
+    if (t_thrd.libpq_cxt.PqDeferredFlushes > 0 && !t_thrd.libpq_cxt.PqCommBusy) {
+        (void)pq_flush();
+    }
+}
+
 /* --------------------------------
  * Message-level I/O routines begin here.
  *
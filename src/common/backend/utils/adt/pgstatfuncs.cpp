@@ -12978,10 +12978,13 @@ Datum gs_globalplancache_status(PG_FUNCTION_ARGS)
         */
         oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
 
-#define GPC_TUPLES_ATTR_NUM 8
+#define GPC_TUPLES_ATTR_NUM 10
+#define GPC_TUPLES_ATTR_NUM_OLD 8
 
-        /* need a tuple descriptor representing 12 columns */
-        tupdesc = CreateTemplateTupleDesc(GPC_TUPLES_ATTR_NUM, false, TAM_HEAP);
+        /* hit_count and plan_time are only in the catalog after upgrade */
+        int attrNum = (t_thrd.proc->workingVersionNum >= GPC_STATUS_STATS_VERSION_NUM) ?
+            GPC_TUPLES_ATTR_NUM : GPC_TUPLES_ATTR_NUM_OLD;
+        tupdesc = CreateTemplateTupleDesc(attrNum, false, TAM_HEAP);
 
         TupleDescInitEntry(tupdesc, (AttrNumber) 1, "nodename",
                            TEXTOID, -1, 0);
@@ -12999,6 +13002,12 @@ Datum gs_globalplancache_status(PG_FUNCTION_ARGS)
                            INT4OID, -1, 0);
         TupleDescInitEntry(tupdesc, (AttrNumber) 8, "func_id",
                            OIDOID, -1, 0);
+        if (attrNum == GPC_TUPLES_ATTR_NUM) {
+            TupleDescInitEntry(tupdesc, (AttrNumber) 9, "hit_count",
+                               INT8OID, -1, 0);
+            TupleDescInitEntry(tupdesc, (AttrNumber) 10, "plan_time",
+                               FLOAT8OID, -1, 0);
+        }
 
         /* complete descriptor of the tupledesc */
         funcctx->tuple_desc = BlessTupleDesc(tupdesc);
@@ -13039,6 +13048,8 @@ Datum gs_globalplancache_status(PG_FUNCTION_ARGS)
         values[5] = CStringGetTextDatum(entry->schema_name);
         values[6] = Int32GetDatum(entry->params_num);
         values[7] = DatumGetObjectId(entry->func_id);
+        values[8] = Int64GetDatum(entry->hit_count);
+        values[9] = Float8GetDatum(entry->plan_time);
 
         tuple = heap_form_tuple(funcctx->tuple_desc, values, nulls);
         SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tuple));
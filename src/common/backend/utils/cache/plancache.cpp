@@ -1103,6 +1103,12 @@ static CachedPlan* BuildCachedPlan(CachedPlanSource* plansource, List* qlist, Pa
     PLpgSQL_execstate *saved_estate = plpgsql_estate;
     bool        outer_is_stream = false;
     bool        outer_is_stream_support = false;
+    instr_time  plan_start;
+
+    INSTR_TIME_SET_ZERO(plan_start);
+    if (ENABLE_GPC) {
+        INSTR_TIME_SET_CURRENT(plan_start);
+    }
 
     /*
      * NOTE: GetCachedPlan should have called RevalidateCachedQuery first, so
@@ -1310,6 +1316,12 @@ static CachedPlan* BuildCachedPlan(CachedPlanSource* plansource, List* qlist, Pa
         GPCCheckStreamPlan(plansource, plist);
 #endif
         GPCFillPlanCache(plansource, isBuildingCustomPlan);
+        if (!isBuildingCustomPlan) {
+            instr_time plan_time;
+            INSTR_TIME_SET_CURRENT(plan_time);
+            INSTR_TIME_SUBTRACT(plan_time, plan_start);
+            plansource->gpc.plan_time = INSTR_TIME_GET_MILLISEC(plan_time);
+        }
     }
 
     plpgsql_estate = saved_estate;
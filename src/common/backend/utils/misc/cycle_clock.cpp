@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2020 Huawei Technologies Co.,Ltd.
+ *
+ * openGauss is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *          http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * ---------------------------------------------------------------------------------------
+ *
+ * cycle_clock.cpp
+ *     Detection and calibration of the CPU cycle counter used by the
+ *     instrumentation clock.
+ *
+ * IDENTIFICATION
+ *        src/common/backend/utils/misc/cycle_clock.cpp
+ *
+ * ---------------------------------------------------------------------------------------
+ */
+#include "postgres.h"
+#include "knl/knl_variable.h"
+
+#include <math.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+#include "utils/cycle_clock.h"
+
+#define CYCLE_CLOCK_CALIBRATE_USEC 10000
+#define CYCLE_CLOCK_CALIBRATE_TRIES 10
+/* two consecutive calibration samples must agree within 0.1% */
+#define CYCLE_CLOCK_TOLERANCE 0.001
+
+bool g_cycle_clock_usable = false;
+double g_cycle_clock_usec_per_cycle = 0.0;
+
+static int64 GetMonotonicUsec(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+/*
+ * The TSC is only a clock if it ticks at a constant rate through frequency and
+ * power state changes, and if the kernel did not find it unsynchronized across
+ * sockets and switch to another clocksource.
+ */
+static bool CycleCounterIsInvariant(void)
+{
+    unsigned int eax = 0;
+    unsigned int ebx = 0;
+    unsigned int ecx = 0;
+    unsigned int edx = 0;
+
+    if (__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) == 0 || eax < 0x80000007) {
+        return false;
+    }
+    if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0 || (edx & (1 << 8)) == 0) {
+        return false;
+    }
+
+    FILE* fp = fopen("/sys/devices/system/clocksource/clocksource0/current_clocksource", "r");
+    if (fp != NULL) {
+        char source[32] = {0};
+        bool isTsc = (fgets(source, sizeof(source), fp) != NULL && strncmp(source, "tsc", 3) == 0);
+        (void)fclose(fp);
+        return isTsc;
+    }
+    return true;
+}
+
+/* cycles per microsecond, measured against CLOCK_MONOTONIC; 0 if the rate is not stable */
+static double CalibrateCycleCounter(void)
+{
+    double lastRate = 0.0;
+
+    for (int i = 0; i < CYCLE_CLOCK_CALIBRATE_TRIES; i++) {
+        int64 startUsec = GetMonotonicUsec();
+        uint64 startCycles = ReadCycleCounter();
+        int64 elapsedUsec;
+        uint64 stopCycles;
+
+        do {
+            elapsedUsec = GetMonotonicUsec() - startUsec;
+            stopCycles = ReadCycleCounter();
+        } while (elapsedUsec < CYCLE_CLOCK_CALIBRATE_USEC);
+
+        double rate = (double)(stopCycles - startCycles) / (double)elapsedUsec;
+        if (lastRate > 0.0 && fabs(rate - lastRate) <= lastRate * CYCLE_CLOCK_TOLERANCE) {
+            return rate;
+        }
+        lastRate = rate;
+    }
+    return 0.0;
+}
+#endif
+
+/*
+ * InitCycleClock - decide whether the instrumentation clock may read the cycle
+ * counter. Called once by the postmaster before it starts any thread.
+ */
+void InitCycleClock(void)
+{
+    double cyclesPerUsec = 0.0;
+
+#if defined(__x86_64__) || defined(__i386__)
+    if (CycleCounterIsInvariant()) {
+        cyclesPerUsec = CalibrateCycleCounter();
+    }
+#elif defined(__aarch64__)
+    /* the generic timer has a fixed frequency, which firmware reports */
+    uint64 freq;
+    __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(freq));
+    cyclesPerUsec = (double)freq / 1000000.0;
+#endif
+
+    if (cyclesPerUsec > 0.0) {
+        g_cycle_clock_usec_per_cycle = 1.0 / cyclesPerUsec;
+        g_cycle_clock_usable = true;
+        ereport(LOG, (errmsg("instrumentation clock uses the cycle counter, %.3f cycles per microsecond",
+            cyclesPerUsec)));
+    } else {
+        g_cycle_clock_usable = false;
+        ereport(LOG, (errmsg("cycle counter is not invariant, instrumentation clock uses CLOCK_MONOTONIC")));
+    }
+}
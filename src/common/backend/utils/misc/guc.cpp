@@ -2543,6 +2543,17 @@ static void InitConfigureNamesBool()
             NULL,
             NULL},
 
+        {{"wal_receiver_compression",
+             PGC_SIGHUP,
+             REPLICATION_STANDBY,
+             gettext_noop("Asks the sender to compress the WAL stream sent to this standby."),
+             NULL},
+            &u_sess->attr.attr_storage.wal_receiver_compression,
+            false,
+            NULL,
+            NULL,
+            NULL},
+
         {{"enable_stream_replication",
              PGC_SIGHUP,
              REPLICATION_STANDBY,
@@ -152,29 +152,60 @@ void gs_memory_disconnect(StreamSharedContext* sharedContext, int nthChannel)
     entry->_signal();
 }
 
-#ifdef __aarch64__
 /*
- * @Description: Judge whether the databuff is empty
+ * @Description: Wait until the producer owns a free slot in the data ring of the channel.
  *
  * @param[IN] sharedContext: context for shared memory stream
  * @param[IN] nthChannel: destination consumer
+ * @return int: slot index, -1 if the consumer does not need data anymore
  */
-bool gs_is_databuff_empty(StreamSharedContext* sharedContext, int nthChannel)
+static int gs_memory_wait_slot(StreamSharedContext* sharedContext, int nthChannel)
 {
-    if (sharedContext->vectorized) {
-        VectorBatch* batch = sharedContext->sharedBatches[nthChannel][u_sess->stream_cxt.smp_id];
-        if (batch->m_rows == 0) {
-            return true;
+    LocalStreamRing* ring = &sharedContext->rings[nthChannel][u_sess->stream_cxt.smp_id];
+    struct hash_entry* entry = sharedContext->quota_entrys[nthChannel][u_sess->stream_cxt.smp_id];
+
+    for (;;) {
+        /* Check for interrupt at the beginning of the loop. */
+        CHECK_FOR_INTERRUPTS();
+
+        /* Check if we should early stop. */
+        /* Quit if the connection close, especially in a early close case. */
+        if (executorEarlyStop() || sharedContext->is_connect_end[nthChannel][u_sess->stream_cxt.smp_id]) {
+            return -1;
         }
-    } else {
-        TupleVector* tupleVec = sharedContext->sharedTuples[nthChannel][u_sess->stream_cxt.smp_id];
-        if (tupleVec->tuplePointer == 0) {
-            return true;
+
+        /* Break the loop if the consumer has released a slot. */
+        if (ring->head - ring->tail < LOCAL_STREAM_RING_SIZE) {
+            break;
         }
+
+        StreamTimeWaitQuotaStart(t_thrd.pgxc_cxt.GlobalNetInstr);
+        (void)entry->_timewait(SINGLE_WAITQUOTA);
+        StreamTimeWaitQuotaEnd(t_thrd.pgxc_cxt.GlobalNetInstr);
     }
-    return false;
+
+    /* Do not touch the slot before the consumer is done with it. */
+    pg_memory_barrier();
+    return ring->head % LOCAL_STREAM_RING_SIZE;
+}
+
+/*
+ * @Description: Publish the slot being filled to the consumer.
+ *
+ * @param[IN] sharedContext: context for shared memory stream
+ * @param[IN] nthChannel: destination consumer
+ */
+static void gs_memory_publish_slot(StreamSharedContext* sharedContext, int nthChannel)
+{
+    LocalStreamRing* ring = &sharedContext->rings[nthChannel][u_sess->stream_cxt.smp_id];
+
+    /* Make the data visible before the consumer can see the slot. */
+    pg_write_barrier();
+    ring->head++;
+
+    /* send signal */
+    sharedContext->poll_entrys[nthChannel]->_signal();
 }
-#endif
 
 /*
  * @Description: Send data to local consumer through shared memory
@@ -191,8 +222,8 @@ void gs_memory_send(
     VectorBatch* batch = NULL;
     TupleVector* tupleVec = NULL;
     bool ready_to_send = false;
-    DataStatus dataStatus;
-    struct hash_entry* entry = NULL;
+    LocalStreamRing* ring = &sharedContext->rings[nthChannel][u_sess->stream_cxt.smp_id];
+    int slot;
 
     WaitState oldStatus = pgstat_report_waitstatus_comm(STATE_WAIT_FLUSH_DATA,
         u_sess->pgxc_cxt.PGXCNodeId,
@@ -201,39 +232,16 @@ void gs_memory_send(
         global_node_definition ? global_node_definition->num_nodes : -1);
 
     StreamTimeSendStart(t_thrd.pgxc_cxt.GlobalNetInstr);
-    entry = sharedContext->quota_entrys[nthChannel][u_sess->stream_cxt.smp_id];
-    for (;;) {
-        /* Check for interrupt at the beginning of the loop. */
-        CHECK_FOR_INTERRUPTS();
-
-        /* Check if we should early stop. */
-        /* Quit if the connection close, especially in a early close case. */
-        if (executorEarlyStop() || sharedContext->is_connect_end[nthChannel][u_sess->stream_cxt.smp_id]) {
-            (void)pgstat_report_waitstatus(oldStatus);
-            return;
-        }
-
-        dataStatus = sharedContext->dataStatus[nthChannel][u_sess->stream_cxt.smp_id];
-        /* Break the loop if we find quota. */
-        if ((dataStatus == DATA_EMPTY
-#ifdef __aarch64__
-             && gs_is_databuff_empty(sharedContext, nthChannel)
-#endif
-             ) ||
-            dataStatus == DATA_PREPARE) {
-            break;
-        }
-
-        StreamTimeWaitQuotaStart(t_thrd.pgxc_cxt.GlobalNetInstr);
-        (void)entry->_timewait(SINGLE_WAITQUOTA);
-        StreamTimeWaitQuotaEnd(t_thrd.pgxc_cxt.GlobalNetInstr);
+    slot = gs_memory_wait_slot(sharedContext, nthChannel);
+    if (slot < 0) {
+        (void)pgstat_report_waitstatus(oldStatus);
+        return;
     }
 
     StreamTimeCopyStart(t_thrd.pgxc_cxt.GlobalNetInstr);
     /* Copy data to shared context. */
     if (sharedContext->vectorized) {
-        Assert(sharedContext->sharedBatches != NULL);
-        batch = sharedContext->sharedBatches[nthChannel][u_sess->stream_cxt.smp_id];
+        batch = ring->batches[slot];
         /* data copy */
         if (-1 == nthRow) {
             /* Do deep copy of all rows, for local roundrobin & local broadcast. */
@@ -247,8 +255,7 @@ void gs_memory_send(
             }
         }
     } else {
-        Assert(sharedContext->sharedTuples != NULL);
-        tupleVec = sharedContext->sharedTuples[nthChannel][u_sess->stream_cxt.smp_id];
+        tupleVec = ring->tuples[slot];
         int n = tupleVec->tuplePointer;
         ExecCopySlot(tupleVec->tupleVector[n], tuple);
         tupleVec->tuplePointer++;
@@ -260,16 +267,54 @@ void gs_memory_send(
 
     /* send the signal if copy finished */
     if (ready_to_send) {
-#ifdef __aarch64__
-        pg_memory_barrier();
-#endif
-        /* set flag */
-        sharedContext->dataStatus[nthChannel][u_sess->stream_cxt.smp_id] = DATA_READY;
-        /* send signal */
-        entry = sharedContext->poll_entrys[nthChannel];
-        entry->_signal();
-    } else {
-        sharedContext->dataStatus[nthChannel][u_sess->stream_cxt.smp_id] = DATA_PREPARE;
+        gs_memory_publish_slot(sharedContext, nthChannel);
+    }
+    StreamTimeSendEnd(t_thrd.pgxc_cxt.GlobalNetInstr);
+
+    (void)pgstat_report_waitstatus(oldStatus);
+}
+
+/*
+ * @Description: Send some rows of a batch to local consumer through shared memory
+ *
+ * @param[IN] batchsrc: batch to be send
+ * @param[IN] sharedContext: context for shared memory stream
+ * @param[IN] nthChannel: destination consumer
+ * @param[IN] rows: the rows to be sent in batch
+ * @param[IN] nrows: number of rows
+ */
+void gs_memory_send_rows(
+    VectorBatch* batchsrc, StreamSharedContext* sharedContext, int nthChannel, const int* rows, int nrows)
+{
+    LocalStreamRing* ring = &sharedContext->rings[nthChannel][u_sess->stream_cxt.smp_id];
+    int sent = 0;
+
+    Assert(sharedContext->vectorized);
+
+    WaitState oldStatus = pgstat_report_waitstatus_comm(STATE_WAIT_FLUSH_DATA,
+        u_sess->pgxc_cxt.PGXCNodeId,
+        -1,
+        u_sess->stream_cxt.producer_obj->getParentPlanNodeId(),
+        global_node_definition ? global_node_definition->num_nodes : -1);
+
+    StreamTimeSendStart(t_thrd.pgxc_cxt.GlobalNetInstr);
+    while (sent < nrows) {
+        int slot = gs_memory_wait_slot(sharedContext, nthChannel);
+        if (slot < 0) {
+            break;
+        }
+
+        VectorBatch* batch = ring->batches[slot];
+        int n = Min(nrows - sent, BatchMaxSize - batch->m_rows);
+
+        StreamTimeCopyStart(t_thrd.pgxc_cxt.GlobalNetInstr);
+        batch->CopyNthRows(batchsrc, rows + sent, n);
+        StreamTimeCopyEnd(t_thrd.pgxc_cxt.GlobalNetInstr);
+        sent += n;
+
+        if (BatchMaxSize == batch->m_rows) {
+            gs_memory_publish_slot(sharedContext, nthChannel);
+        }
     }
     StreamTimeSendEnd(t_thrd.pgxc_cxt.GlobalNetInstr);
 
@@ -308,22 +353,43 @@ bool gs_return_tuple(StreamState* node)
 bool gs_consume_memory_data(StreamState* node, int loc)
 {
     StreamSharedContext* sharedContext = node->sharedContext;
+    LocalStreamRing* ring = &sharedContext->rings[u_sess->stream_cxt.smp_id][loc];
+    int slot = ring->tail % LOCAL_STREAM_RING_SIZE;
+
+    /*
+     * Without published slot, only the rest data of a finished producer is left
+     * in the slot it was filling.
+     */
+    bool published = (ring->head != ring->tail);
+
+    /* Read the data only after seeing the slot published. */
+    pg_read_barrier();
 
     NetWorkTimeCopyStart(t_thrd.pgxc_cxt.GlobalNetInstr);
     /* Take data from the shared context. */
     if (sharedContext->vectorized) {
-        VectorBatch* batchsrc = sharedContext->sharedBatches[u_sess->stream_cxt.smp_id][loc];
-        VectorBatch* batchdst = ((VecStreamState*)node)->m_CurrentBatch;
+        VecStreamState* vnode = (VecStreamState*)node;
+        VectorBatch* batchsrc = ring->batches[slot];
+        VectorBatch* batchdst = vnode->m_CurrentBatch;
 
         if (batchsrc->m_rows == 0) {
             return false;
         }
 
-        batchdst->Copy<true, false>(batchsrc);
-
-        batchsrc->Reset();
+        /*
+         * Take over the batch instead of copying it, and give back the one we are
+         * done with. The first time, our batch is not in the shared context yet.
+         */
+        if (unlikely(!vnode->m_sharedBatch)) {
+            batchdst = New(sharedContext->localStreamMemoryCtx)
+                VectorBatch(sharedContext->localStreamMemoryCtx, batchsrc);
+            vnode->m_sharedBatch = true;
+        }
+        batchdst->Reset();
+        ring->batches[slot] = batchdst;
+        vnode->m_CurrentBatch = batchsrc;
     } else {
-        TupleVector* tuplesrc = sharedContext->sharedTuples[u_sess->stream_cxt.smp_id][loc];
+        TupleVector* tuplesrc = ring->tuples[slot];
         TupleVector* tupledst = node->tempTupleVec;
 
         if (tuplesrc->tuplePointer == 0) {
@@ -340,17 +406,14 @@ bool gs_consume_memory_data(StreamState* node, int loc)
     }
     NetWorkTimeCopyEnd(t_thrd.pgxc_cxt.GlobalNetInstr);
 
-    struct hash_entry* entry = NULL;
-    entry = sharedContext->quota_entrys[u_sess->stream_cxt.smp_id][loc];
-
-#ifdef __aarch64__
-    pg_memory_barrier();
-#endif
-    /* Reset flag */
-    sharedContext->dataStatus[u_sess->stream_cxt.smp_id][loc] = DATA_EMPTY;
+    if (published) {
+        /* Release the slot only after we are done with it. */
+        pg_memory_barrier();
+        ring->tail++;
 
-    /* send signal */
-    entry->_signal();
+        /* send signal */
+        sharedContext->quota_entrys[u_sess->stream_cxt.smp_id][loc]->_signal();
+    }
 
     node->sharedContext->scanLoc[u_sess->stream_cxt.smp_id] = loc;
     return true;
@@ -414,39 +477,23 @@ char gs_find_memory_data(StreamState* node, int* waitnode_count)
             }
         }
 
-        switch (dataStatus) {
-            case DATA_EMPTY:
-                break;
-
-            case DATA_PREPARE:
-                /* Take the rest data away when the connection is end. */
-                if (is_conn_end) {
-                    /* Return data if any. */
-                    if (gs_consume_memory_data(node, i)) {
-                        return STREAM_SCAN_DATA;
-                    }
-                }
-                break;
-
-            case DATA_READY:
-                if (gs_consume_memory_data(node, i)) {
-                    return STREAM_SCAN_DATA;
-                } else {
-                    break;
-                }
-
-            case CONN_ERR:
-                ereport(ERROR,
-                    (errcode(ERRCODE_STREAM_REMOTE_CLOSE_SOCKET),
-                        errmsg("Failed to read response from Local Stream Node,"
-                               " Detail: Node %s, Plan Node ID %u, SMP ID %d",
-                            g_instance.attr.attr_common.PGXCNodeName,
-                            node->sharedContext->key_s.planNodeId,
-                            i)));
-                break;
-            // dataStatus is enum,
-            default:
-                break;
+        if (dataStatus == CONN_ERR) {
+            ereport(ERROR,
+                (errcode(ERRCODE_STREAM_REMOTE_CLOSE_SOCKET),
+                    errmsg("Failed to read response from Local Stream Node,"
+                           " Detail: Node %s, Plan Node ID %u, SMP ID %d",
+                        g_instance.attr.attr_common.PGXCNodeName,
+                        node->sharedContext->key_s.planNodeId,
+                        i)));
+        }
+
+        /* Take the published data, or the rest data away when the connection is end. */
+        LocalStreamRing* ring = &node->sharedContext->rings[u_sess->stream_cxt.smp_id][i];
+        if (ring->head != ring->tail || is_conn_end) {
+            /* Return data if any. */
+            if (gs_consume_memory_data(node, i)) {
+                return STREAM_SCAN_DATA;
+            }
         }
     } while (i != scanLoc);
 
@@ -527,6 +574,9 @@ void gs_memory_send_finish(StreamSharedContext* sharedContext, int connNum)
 {
     struct hash_entry* entry = NULL;
 
+    /* The rest data must be visible before the consumers see the end. */
+    pg_write_barrier();
+
     for (int i = 0; i < connNum; i++) {
         /* Set flags. */
         sharedContext->is_connect_end[i][u_sess->stream_cxt.smp_id] = true;
@@ -74,6 +74,18 @@ typedef struct {
     char* unique_sql; /* unique sql text */
 } ASHUniqueSQL;
 
+/* samples of one plan node of one unique sql, aggregated over the rolling buffer */
+typedef struct {
+    UniqueSQLKey unique_sql_key;
+    int plannodeid;
+} ASHOperatorKey;
+
+typedef struct {
+    ASHOperatorKey key;
+    uint64 samples;     /* samples taken while the thread was in this plan node */
+    uint64 cpu_samples; /* those of them that were not waiting on anything */
+} ASHOperatorEntry;
+
 namespace Asp {
     void SubAspWorker();
 }
@@ -368,6 +380,10 @@ static void FormatSQLInfo(cJSON * root, SessionHistEntry *beentry)
     } else {
         cJSON_AddItemToObject(root, "unique_query", cJSON_CreateNull());
     }
+    if (beentry->exec_plannodeid != -1)
+        (void)cJSON_AddItemToObject(root, "plan_node_id", cJSON_CreateNumber(beentry->exec_plannodeid));
+    else
+        (void)cJSON_AddItemToObject(root, "plan_node_id", cJSON_CreateNull());
 }
 static void FormatBasicInfo(cJSON * root, SessionHistEntry *beentry)
 {
@@ -831,6 +847,99 @@ static void WriteToSysTable(SessionHistEntry *beentry)
     heap_close(rel, RowExclusiveLock);
 }
 
+static inline bool IsOnCpuSample(const SessionHistEntry *beentry)
+{
+    return beentry->waitevent == WAIT_EVENT_END && beentry->waitstatus == STATE_WAIT_UNDEFINED;
+}
+
+/*
+ * Aggregate the samples of the rolling buffer by unique sql and plan node.
+ * The buffer is written by the asp thread only, readers from other threads
+ * copy each slot under its change count. Unless all_users is set, only the
+ * samples of the current user are counted.
+ */
+static HTAB* AggregateOperatorSamples(bool all_users)
+{
+    ActiveSessHistArrary *active_sess_hist_arrary = g_instance.stat_cxt.active_sess_hist_arrary;
+    HASHCTL ctl;
+    errno_t rc = memset_s(&ctl, sizeof(ctl), 0, sizeof(ctl));
+    securec_check(rc, "\0", "\0");
+    ctl.keysize = sizeof(ASHOperatorKey);
+    ctl.entrysize = sizeof(ASHOperatorEntry);
+    ctl.hcxt = CurrentMemoryContext;
+    HTAB *operators = hash_create("ASP operator profile", 256, &ctl, HASH_ELEM | HASH_CONTEXT);
+
+    for (uint32 i = 0; i < active_sess_hist_arrary->max_size; i++) {
+        SessionHistEntry *ash_arrary_slot = active_sess_hist_arrary->active_sess_hist_info + i;
+        ASHOperatorKey key;
+        Oid userid = InvalidOid;
+        bool on_cpu = false;
+
+        /* the key is hashed as a blob, clear the padding */
+        rc = memset_s(&key, sizeof(key), 0, sizeof(key));
+        securec_check(rc, "\0", "\0");
+        for (;;) {
+            uint64 save_changecount = ash_arrary_slot->changCount;
+            key.unique_sql_key = ash_arrary_slot->unique_sql_key;
+            key.plannodeid = ash_arrary_slot->exec_plannodeid;
+            userid = ash_arrary_slot->userid;
+            on_cpu = IsOnCpuSample(ash_arrary_slot);
+            if (save_changecount == ash_arrary_slot->changCount && ((unsigned int)save_changecount & 1) == 0)
+                break;
+        }
+        if (key.plannodeid == -1 || key.unique_sql_key.unique_sql_id == 0) {
+            continue;
+        }
+        if (!all_users && userid != GetUserId()) {
+            continue;
+        }
+
+        bool found = false;
+        ASHOperatorEntry *entry = (ASHOperatorEntry*)hash_search(operators, &key, HASH_ENTER, &found);
+        if (!found) {
+            entry->samples = 0;
+            entry->cpu_samples = 0;
+        }
+        entry->samples++;
+        if (on_cpu) {
+            entry->cpu_samples++;
+        }
+    }
+    return operators;
+}
+
+/*
+ * Write one json line per operator of the rolling buffer, so the statements'
+ * time can be broken down to operators without running EXPLAIN ANALYZE.
+ */
+static void WriteOperatorProfile()
+{
+    HTAB *operators = AggregateOperatorSamples(true);
+
+    HASH_SEQ_STATUS hash_seq;
+    ASHOperatorEntry *entry = NULL;
+    hash_seq_init(&hash_seq, operators);
+    while ((entry = (ASHOperatorEntry*)hash_seq_search(&hash_seq)) != NULL) {
+        char unique_query_id[MAX_LEN_CHAR_TO_BIGINT_BUF] = {0};
+        (void)uint64_to_str(unique_query_id, MAX_LEN_CHAR_TO_BIGINT_BUF, entry->key.unique_sql_key.unique_sql_id);
+
+        cJSON *root = cJSON_CreateObject();
+        (void)cJSON_AddItemToObject(root, "operator_profile", cJSON_CreateTrue());
+        (void)cJSON_AddItemToObject(root, "unique_query_id", cJSON_CreateString(unique_query_id));
+        (void)cJSON_AddItemToObject(root, "user_id", cJSON_CreateNumber(entry->key.unique_sql_key.user_id));
+        (void)cJSON_AddItemToObject(root, "cn_id", cJSON_CreateNumber(entry->key.unique_sql_key.cn_id));
+        (void)cJSON_AddItemToObject(root, "plan_node_id", cJSON_CreateNumber(entry->key.plannodeid));
+        (void)cJSON_AddItemToObject(root, "samples", cJSON_CreateNumber((double)entry->samples));
+        (void)cJSON_AddItemToObject(root, "cpu_samples", cJSON_CreateNumber((double)entry->cpu_samples));
+        char *cjson_str = cJSON_PrintUnformatted(root);
+        ereport(LOG, (errcode(ERRCODE_ACTIVE_SESSION_PROFILE),
+            errmsg("%s", cjson_str), errhidestmt(true), errhideprefix(true)));
+        pfree_ext(cjson_str);
+        cJSON_Delete(root);
+    }
+    hash_destroy(operators);
+}
+
 /*
  * Convert the active session data in buff to json format and write it to a file
  * By default, the data in the buff is written to the file at 10: 1
@@ -868,6 +977,10 @@ static void WriteActiveSessInfo()
         PG_RE_THROW();
     }
     PG_END_TRY();
+    if (strcmp(u_sess->attr.attr_common.asp_flush_mode, "file") == 0 ||
+        strcmp(u_sess->attr.attr_common.asp_flush_mode, "all") == 0) {
+        WriteOperatorProfile();
+    }
     CleanupAspUniqueSqlHash();
 }
 
@@ -930,6 +1043,7 @@ static BackendState CopyActiveSessInfo(uint64 sample_id, bool need_flush_sample,
     ash_arrary_slot->waitnode_count = beentry->st_waitnode_count;
     ash_arrary_slot->nodeid = beentry->st_nodeid;
     ash_arrary_slot->plannodeid = beentry->st_plannodeid;
+    ash_arrary_slot->exec_plannodeid = beentry->st_exec_plannodeid;
     ash_arrary_slot->libpq_wait_nodeid = beentry->st_libpq_wait_nodeid;
     ash_arrary_slot->libpq_wait_nodecount = beentry->st_libpq_wait_nodecount;
     ash_arrary_slot->waitstatus_phase = beentry->st_waitstatus_phase;
@@ -1225,3 +1339,73 @@ Datum get_local_active_session(PG_FUNCTION_ARGS)
         SRF_RETURN_DONE(funcctx);
     }
 }
+
+#define OPERATOR_PROFILE_ATTRNUM 6
+
+/*
+ * Samples of the rolling buffer per unique sql and plan node, the same numbers
+ * the asp thread writes to the asp log in file mode.
+ */
+Datum get_local_operator_profile(PG_FUNCTION_ARGS)
+{
+    FuncCallContext* funcctx = NULL;
+    if (SRF_IS_FIRSTCALL()) {
+        funcctx = SRF_FIRSTCALL_INIT();
+        MemoryContext oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+
+        TupleDesc tupdesc = CreateTemplateTupleDesc(OPERATOR_PROFILE_ATTRNUM, false);
+        int i = 1;
+        TupleDescInitEntry(tupdesc, (AttrNumber)i++, "unique_query_id", INT8OID, -1, 0);
+        TupleDescInitEntry(tupdesc, (AttrNumber)i++, "user_id", OIDOID, -1, 0);
+        TupleDescInitEntry(tupdesc, (AttrNumber)i++, "cn_id", INT4OID, -1, 0);
+        TupleDescInitEntry(tupdesc, (AttrNumber)i++, "plan_node_id", INT4OID, -1, 0);
+        TupleDescInitEntry(tupdesc, (AttrNumber)i++, "samples", INT8OID, -1, 0);
+        TupleDescInitEntry(tupdesc, (AttrNumber)i++, "cpu_samples", INT8OID, -1, 0);
+        funcctx->tuple_desc = BlessTupleDesc(tupdesc);
+
+        if (!u_sess->attr.attr_common.enable_asp) {
+            ereport(WARNING, (errcode(ERRCODE_WARNING), (errmsg("GUC parameter 'enable_asp' is off"))));
+            (void)MemoryContextSwitchTo(oldcontext);
+            SRF_RETURN_DONE(funcctx);
+        }
+
+        /* Values of other users only available to superuser and monitor admin */
+        HTAB *operators = AggregateOperatorSamples(superuser() || isMonitoradmin(GetUserId()));
+        long num_operators = hash_get_num_entries(operators);
+        ASHOperatorEntry *entries = (ASHOperatorEntry*)palloc0(sizeof(ASHOperatorEntry) * (num_operators + 1));
+        HASH_SEQ_STATUS hash_seq;
+        ASHOperatorEntry *entry = NULL;
+        long n = 0;
+        hash_seq_init(&hash_seq, operators);
+        while ((entry = (ASHOperatorEntry*)hash_seq_search(&hash_seq)) != NULL) {
+            entries[n++] = *entry;
+        }
+        hash_destroy(operators);
+
+        funcctx->user_fctx = entries;
+        funcctx->max_calls = n;
+        (void)MemoryContextSwitchTo(oldcontext);
+    }
+    /* stuff done on every call of the function */
+    funcctx = SRF_PERCALL_SETUP();
+
+    if (funcctx->call_cntr < funcctx->max_calls) {
+        Datum values[OPERATOR_PROFILE_ATTRNUM];
+        bool nulls[OPERATOR_PROFILE_ATTRNUM] = {false};
+        ASHOperatorEntry *entry = (ASHOperatorEntry*)funcctx->user_fctx + funcctx->call_cntr;
+        int i = 0;
+
+        values[i++] = Int64GetDatum(entry->key.unique_sql_key.unique_sql_id);
+        values[i++] = ObjectIdGetDatum(entry->key.unique_sql_key.user_id);
+        values[i++] = UInt32GetDatum(entry->key.unique_sql_key.cn_id);
+        values[i++] = Int32GetDatum(entry->key.plannodeid);
+        values[i++] = Int64GetDatum(entry->samples);
+        values[i++] = Int64GetDatum(entry->cpu_samples);
+        HeapTuple tuple = heap_form_tuple(funcctx->tuple_desc, values, nulls);
+
+        SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tuple));
+    } else {
+        /* nothing left */
+        SRF_RETURN_DONE(funcctx);
+    }
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2020 Huawei Technologies Co.,Ltd.
+ *
+ * openGauss is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *          http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------
+ * latency_sketch.cpp
+ *
+ *    Mergeable quantile sketch for response times
+ *
+ * IDENTIFICATION
+ *	  src/gausskernel/cbb/instruments/percentile/latency_sketch.cpp
+ *
+ * -------------------------------------------------------------------------
+ */
+#include "postgres.h"
+#include "knl/knl_variable.h"
+#include "instruments/latency_sketch.h"
+
+/* middle of the value range counted by the given bucket */
+static int64 LatencySketchBucketValue(int bucket)
+{
+    if (bucket < LATENCY_SKETCH_SUB_BUCKETS) {
+        return bucket;
+    }
+
+    int exp = bucket / LATENCY_SKETCH_SUB_BUCKETS + LATENCY_SKETCH_SUB_BITS - 1;
+    int sub = bucket % LATENCY_SKETCH_SUB_BUCKETS;
+    int shift = exp - LATENCY_SKETCH_SUB_BITS;
+    int64 lower = (int64)(LATENCY_SKETCH_SUB_BUCKETS + sub) << shift;
+
+    return lower + (((int64)1 << shift) >> 1);
+}
+
+void LatencySketchReset(LatencySketch* sketch)
+{
+    for (int i = 0; i < LATENCY_SKETCH_BUCKETS; i++) {
+        pg_atomic_write_u32(&sketch->counts[i], 0);
+    }
+}
+
+void LatencySketchMerge(LatencySketch* dst, const LatencySketch* src)
+{
+    for (int i = 0; i < LATENCY_SKETCH_BUCKETS; i++) {
+        uint32 count = src->counts[i];
+        if (count != 0) {
+            (void)pg_atomic_fetch_add_u32(&dst->counts[i], count);
+        }
+    }
+}
+
+/*
+ * Merge src into dst and clear src, without losing values that are
+ * concurrently added to src.
+ */
+void LatencySketchMoveTo(LatencySketch* src, LatencySketch* dst)
+{
+    for (int i = 0; i < LATENCY_SKETCH_BUCKETS; i++) {
+        if (src->counts[i] != 0) {
+            dst->counts[i] += pg_atomic_exchange_u32(&src->counts[i], 0);
+        }
+    }
+}
+
+/*
+ * LatencySketchQuantile - value below which the given fraction of the counted
+ * values fall, 0 if the sketch is empty.
+ */
+int64 LatencySketchQuantile(const LatencySketch* sketch, double quantile)
+{
+    uint32 counts[LATENCY_SKETCH_BUCKETS];
+    uint64 total = 0;
+
+    /* take a stable copy, the sketch may be updated concurrently */
+    for (int i = 0; i < LATENCY_SKETCH_BUCKETS; i++) {
+        counts[i] = sketch->counts[i];
+        total += counts[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    quantile = Max(quantile, 0.0);
+    quantile = Min(quantile, 1.0);
+
+    uint64 rank = (uint64)(quantile * (double)(total - 1)) + 1;
+    uint64 seen = 0;
+    for (int i = 0; i < LATENCY_SKETCH_BUCKETS; i++) {
+        seen += counts[i];
+        if (seen >= rank) {
+            return LatencySketchBucketValue(i);
+        }
+    }
+    return LatencySketchBucketValue(LATENCY_SKETCH_BUCKETS - 1);
+}
@@ -44,6 +44,7 @@
 #include "storage/ipc.h"
 #include "pgxc/poolutils.h"
 #include "instruments/percentile.h"
+#include "instruments/latency_sketch.h"
 #include "utils/postinit.h"
 
 extern void destroy_handles();
@@ -56,6 +57,8 @@ bool SetTimer(TimestampTz start, TimestampTz stop);
 bool ResetTimer(int interval);
 int64 calculate_percentile(SqlRTInfo* sql_rt_info, int counter, int percentile);
 void CalculatePercentile(SqlRTInfo* sqlRT, int counter);
+void CalculateSketchPercentile(const LatencySketch* sketch);
+List* GetPercentileList(char** percentile, SqlRTInfo* sqlRT);
 void adjust(SqlRTInfo* sqlRT, int len, int index);
 void heapSort(SqlRTInfo* sqlRT, int size);
 void init_gspqsignal();
@@ -114,6 +117,11 @@ void InitPercentile(void)
             (SqlRTInfoArray *)MemoryContextAllocZero(
             g_instance.stat_cxt.InstrPercentileContext, sizeof(SqlRTInfoArray));
     }
+
+    if (g_instance.stat_cxt.rt_sketch == NULL) {
+        g_instance.stat_cxt.rt_sketch =
+            (LatencySketch*)MemoryContextAllocZero(g_instance.stat_cxt.InstrPercentileContext, sizeof(LatencySketch));
+    }
 }
 
 void PercentileSpace::init_gspqsignal()
@@ -280,24 +288,26 @@ bool PercentileSpace::is_enable_percentile_thread(void)
     return false;
 }
 
+/*
+ * A single node counts response times in a sketch instead of the sample array,
+ * so there is nothing to copy or sort, and no sample is dropped when busy.
+ */
 void PercentileSpace::calculatePercentileOfSingleNode(void)
 {
-    SqlRTInfo* sqlRT = NULL;
+    LatencySketch* sketch = NULL;
 
-    if (!u_sess->attr.attr_common.enable_instr_rt_percentile)
+    if (!u_sess->attr.attr_common.enable_instr_rt_percentile || g_instance.stat_cxt.rt_sketch == NULL)
         return;
     PG_TRY();
     {
-        int LocalCount = pgstat_fetch_sql_rt_info_counter();;
-        sqlRT = (SqlRTInfo*)palloc0(LocalCount * sizeof(SqlRTInfo));
-        pgstat_fetch_sql_rt_info_internal(sqlRT);
-        PercentileSpace::heapSort(sqlRT, LocalCount);
-        PercentileSpace::CalculatePercentile(sqlRT, LocalCount);
-        pfree_ext(sqlRT);
+        sketch = (LatencySketch*)palloc0(sizeof(LatencySketch));
+        LatencySketchMoveTo(g_instance.stat_cxt.rt_sketch, sketch);
+        PercentileSpace::CalculateSketchPercentile(sketch);
+        pfree_ext(sketch);
     }
     PG_CATCH();
     {
-        pfree_ext(sqlRT);
+        pfree_ext(sketch);
         FlushErrorState();
         elog(WARNING, "Percentile job failed");
     }
@@ -573,37 +583,66 @@ void PercentileSpace::heapSort(SqlRTInfo* sqlRT, int size)
     }
 }
 
-void PercentileSpace::CalculatePercentile(SqlRTInfo* sqlRT, int counter)
+/* parse guc percentile_values, the caller frees *percentile and the list */
+List* PercentileSpace::GetPercentileList(char** percentile, SqlRTInfo* sqlRT)
 {
-    char* percentile = NULL;
     List* percentilelist = NIL;
-    ListCell* l = NULL;
-    int i = 0;
-    if (counter == 0) {
-        /* there is no sql executed during last 10 seconds, so the percentile is 0 */
-        for (int j = 0; j < NUM_PERCENTILE_COUNT; j++) {
-            g_instance.stat_cxt.RTPERCENTILE[j] = 0;
-        }
-        return;
-    }
 
     /* guc paramater percentile_values is reserved, only surport 80,95 now */
-    percentile = pstrdup(u_sess->attr.attr_common.percentile_values);
-    if (!SplitIdentifierInteger(percentile, ',', &percentilelist)) {
+    *percentile = pstrdup(u_sess->attr.attr_common.percentile_values);
+    if (!SplitIdentifierInteger(*percentile, ',', &percentilelist)) {
         /* syntax error in name list */
         /* this should not happen if GUC checked check_percentile */
-        pfree_ext(percentile);
+        pfree_ext(*percentile);
         list_free_ext(percentilelist);
         pfree_ext(sqlRT);
         ereport(ERROR, (errcode(ERRCODE_UNEXPECTED_NODE_STATE), errmsg("Invalid percentile syntax")));
     }
 
     if (list_length(percentilelist) > NUM_PERCENTILE_COUNT) {
-        pfree_ext(percentile);
+        pfree_ext(*percentile);
         list_free_ext(percentilelist);
         pfree_ext(sqlRT);
         ereport(ERROR, (errcode(ERRCODE_UNEXPECTED_NODE_STATE), errmsg("Too many percentile values")));
     }
+    return percentilelist;
+}
+
+void PercentileSpace::CalculateSketchPercentile(const LatencySketch* sketch)
+{
+    char* percentile = NULL;
+    List* percentilelist = NIL;
+    ListCell* l = NULL;
+    int i = 0;
+
+    /* an empty sketch yields 0, as CalculatePercentile does for no samples */
+    percentilelist = PercentileSpace::GetPercentileList(&percentile, NULL);
+
+    LWLockAcquire(PercentileLock, LW_EXCLUSIVE);
+    foreach (l, percentilelist) {
+        int pv = pg_atoi((char*)lfirst(l), sizeof(int), 0);
+        g_instance.stat_cxt.RTPERCENTILE[i++] = LatencySketchQuantile(sketch, pv / 100.0);
+    }
+    LWLockRelease(PercentileLock);
+    pfree_ext(percentile);
+    list_free_ext(percentilelist);
+}
+
+void PercentileSpace::CalculatePercentile(SqlRTInfo* sqlRT, int counter)
+{
+    char* percentile = NULL;
+    List* percentilelist = NIL;
+    ListCell* l = NULL;
+    int i = 0;
+    if (counter == 0) {
+        /* there is no sql executed during last 10 seconds, so the percentile is 0 */
+        for (int j = 0; j < NUM_PERCENTILE_COUNT; j++) {
+            g_instance.stat_cxt.RTPERCENTILE[j] = 0;
+        }
+        return;
+    }
+
+    percentilelist = PercentileSpace::GetPercentileList(&percentile, sqlRT);
 
     LWLockAcquire(PercentileLock, LW_EXCLUSIVE);
     foreach (l, percentilelist) {
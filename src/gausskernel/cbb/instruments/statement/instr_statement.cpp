@@ -62,6 +62,7 @@
 #include "utils/builtins.h"
 #include "commands/explain.h"
 #include "utils/fmgroids.h"
+#include "utils/cycle_clock.h"
 #include "utils/relcache.h"
 #include "commands/copy.h"
 
@@ -1003,7 +1004,8 @@ void update_stmt_lock_cnt(StatementStatContext *ssctx, StmtDetailType type, int
     }
 }
 
-static void update_stmt_lock_time(StatementStatContext *ssctx, StmtDetailType type, TimestampTz curTime)
+/* the lock durations are measured on the cycle clock, see utils/cycle_clock.h */
+static void update_stmt_lock_time(StatementStatContext *ssctx, StmtDetailType type, int64 curTime)
 {
     switch (type) {
         case LOCK_START:
@@ -1047,15 +1049,14 @@ void instr_stmt_report_lock(StmtDetailType type, int lockmode, const LOCKTAG *lo
         update_stmt_lock_cnt(ssctx, type, lockmode);
 
         if (ssctx->level != STMT_TRACK_L0) {
-            TimestampTz curTime = GetCurrentTimestamp();
-
-            update_stmt_lock_time(ssctx, type, curTime);
+            update_stmt_lock_time(ssctx, type, GetCycleClockUsec());
             if (ssctx->level == STMT_TRACK_L2) {
                 size_t size = 0;
                 char *bytes = NULL;
                 StmtLockDetail detail = {type, locktag, lwlockId, lockmode};
 
-                bytes = (char*)get_stmt_lock_detail(&detail, curTime, &size);
+                /* the detail record shows when the event happened, so it keeps the wall clock */
+                bytes = (char*)get_stmt_lock_detail(&detail, GetCurrentTimestamp(), &size);
                 statement_detail_info_record(ssctx, bytes, size);
                 pfree_ext(bytes);
             }
@@ -150,6 +150,7 @@ static void resetUniqueSQLEntry(UniqueSQL* entry)
         gs_lock_test_and_set_64(&(entry->elapse_time.total_time), 0);
         gs_lock_test_and_set_64(&(entry->elapse_time.min_time), 0);
         gs_lock_test_and_set_64(&(entry->elapse_time.max_time), 0);
+        LatencySketchReset(&(entry->elapse_sketch));
 
         // reset row activity stat
         pg_atomic_write_u64(&(entry->row_activity.returned_rows), 0);
@@ -314,6 +315,7 @@ static void UpdateUniqueSQLElapseTime(UniqueSQL* unique_sql, int64 elapse_start)
     gs_atomic_add_64(&(unique_sql->elapse_time.total_time), elapse_time);
     updateMaxValueForAtomicType(elapse_time, &(unique_sql->elapse_time.max_time));
     updateMinValueForAtomicType(elapse_time, &(unique_sql->elapse_time.min_time));
+    LatencySketchAdd(&(unique_sql->elapse_sketch), elapse_time);
 }
 
 /*
@@ -1122,6 +1124,8 @@ static void copy_unique_sql_entry(UniqueSQL* unique_sql_array, int num, int i, U
     unique_sql_array[i].elapse_time.total_time = entry->elapse_time.total_time;
     unique_sql_array[i].elapse_time.min_time = entry->elapse_time.min_time;
     unique_sql_array[i].elapse_time.max_time = entry->elapse_time.max_time;
+    LatencySketchReset(&unique_sql_array[i].elapse_sketch);
+    LatencySketchMerge(&unique_sql_array[i].elapse_sketch, &entry->elapse_sketch);
     // row activity
     unique_sql_array[i].row_activity.returned_rows = entry->row_activity.returned_rows;
     unique_sql_array[i].row_activity.tuples_fetched = entry->row_activity.tuples_fetched;
@@ -1481,6 +1485,11 @@ static void create_tuple_entry(TupleDesc tupdesc)
     TupleDescInitEntry(tupdesc, (AttrNumber)++i, "hash_mem_used", INT8OID, -1, 0);
     TupleDescInitEntry(tupdesc, (AttrNumber)++i, "hash_spill_count", INT8OID, -1, 0);
     TupleDescInitEntry(tupdesc, (AttrNumber)++i, "hash_spill_size", INT8OID, -1, 0);
+
+    if (i < tupdesc->natts) {
+        TupleDescInitEntry(tupdesc, (AttrNumber)++i, "p99_elapse_time", INT8OID, -1, 0);
+        TupleDescInitEntry(tupdesc, (AttrNumber)++i, "p999_elapse_time", INT8OID, -1, 0);
+    }
 }
 
 static void set_tuple_cn_node_name(UniqueSQL* unique_sql, Datum* values, int* i)
@@ -1600,6 +1609,12 @@ static void set_tuple_value(UniqueSQL* unique_sql, Datum* values, bool* nulls, i
     values[i++] = Int64GetDatum(unique_sql->hash_state.spill_counts);
     values[i++] = Int64GetDatum(unique_sql->hash_state.spill_size);
 
+    // response time percentiles, only in the catalog after upgrade
+    if (i < arr_size) {
+        values[i++] = Int64GetDatum(LatencySketchQuantile(&unique_sql->elapse_sketch, 0.99));
+        values[i++] = Int64GetDatum(LatencySketchQuantile(&unique_sql->elapse_sketch, 0.999));
+    }
+
     Assert(arr_size == i);
 }
 
@@ -1637,7 +1652,10 @@ Datum get_instr_unique_sql(PG_FUNCTION_ARGS)
 {
     FuncCallContext* funcctx = NULL;
     long num = 0;
-#define INSTRUMENTS_UNIQUE_SQL_ATTRNUM (35 + TOTAL_TIME_INFO_TYPES - 1)
+#define INSTRUMENTS_UNIQUE_SQL_ATTRNUM (37 + TOTAL_TIME_INFO_TYPES - 1)
+#define INSTRUMENTS_UNIQUE_SQL_ATTRNUM_OLD (35 + TOTAL_TIME_INFO_TYPES - 1)
+    int attrNum = (t_thrd.proc->workingVersionNum >= UNIQUE_SQL_PERCENTILE_VERSION_NUM) ?
+        INSTRUMENTS_UNIQUE_SQL_ATTRNUM : INSTRUMENTS_UNIQUE_SQL_ATTRNUM_OLD;
     CheckVersion();
     check_unique_sql_permission();
 
@@ -1648,7 +1666,7 @@ Datum get_instr_unique_sql(PG_FUNCTION_ARGS)
         funcctx = SRF_FIRSTCALL_INIT();
         oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
 
-        tupdesc = CreateTemplateTupleDesc(INSTRUMENTS_UNIQUE_SQL_ATTRNUM, false, TAM_HEAP);
+        tupdesc = CreateTemplateTupleDesc(attrNum, false, TAM_HEAP);
         create_tuple_entry(tupdesc);
 
         funcctx->tuple_desc = BlessTupleDesc(tupdesc);
@@ -1680,7 +1698,7 @@ Datum get_instr_unique_sql(PG_FUNCTION_ARGS)
         rc = memset_s(nulls, sizeof(nulls), 0, sizeof(nulls));
         securec_check(rc, "\0", "\0");
 
-        set_tuple_value(unique_sql, values, nulls, INSTRUMENTS_UNIQUE_SQL_ATTRNUM);
+        set_tuple_value(unique_sql, values, nulls, attrNum);
         tuple = heap_form_tuple(funcctx->tuple_desc, values, nulls);
         SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tuple));
     } else {
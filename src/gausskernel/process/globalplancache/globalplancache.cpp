@@ -140,6 +140,23 @@ int GPCKeyMatch(const void *left, const void *right, Size keysize)
     return 0;
 }
 
+/*
+ * Free a shared plansource which has been unlinked from the hash table or the
+ * invalid list with refcount zero. Nobody can reach it any more, so callers
+ * do this after releasing the GPC locks instead of freeing memory under them.
+ */
+void GPCDestroyPlanSource(CachedPlanSource* plansource)
+{
+    DropCachedPlanInternal(plansource);
+    plansource->magic = 0;
+    MemoryContextUnSeal(plansource->context);
+    MemoryContextUnSeal(plansource->query_context);
+    if (plansource->opFusionObj) {
+        OpFusion::DropGlobalOpfusion((OpFusion*)(plansource->opFusionObj));
+    }
+    MemoryContextDelete(plansource->context);
+}
+
 void GPCKeyDeepCopy(const GPCKey *srcGpckey, GPCKey *destGpckey)
 {
     *destGpckey = *srcGpckey;
@@ -249,6 +266,7 @@ bool GlobalPlanCache::TryStore(CachedPlanSource *plansource,  PreparedStatement
         /* Set the magic number. */
         entry->val.plansource = plansource;
         entry->val.used_count = 0;
+        entry->val.hit_count = 0;
         INSTR_TIME_SET_CURRENT(entry->val.last_use_time);
         /* off the link */
         plansource->next_saved = NULL;
@@ -337,8 +355,12 @@ CachedPlanSource* GlobalPlanCache::Fetch(const char *query_string, uint32 query_
     Assert (bucket_id >= 0 && bucket_id < GPC_NUM_OF_BUCKETS);
     int lock_id = m_array[bucket_id].lockId;
 
+    /*
+     * Keep the shared lock as short as possible, it is taken by every parse of
+     * every session. HASH_FIND never allocates, so no need to switch into the
+     * bucket context, and the statistics are updated atomically.
+     */
     (void)LWLockAcquire(GetMainLWLockByIndex(lock_id), LW_SHARED);
-    MemoryContext oldcontext = MemoryContextSwitchTo(m_array[bucket_id].context);
 
     bool foundCachedEntry = false;
     GPCEntry *entry = (GPCEntry *) hash_search_with_hash_value(m_array[bucket_id].hash_tbl,
@@ -348,7 +370,6 @@ CachedPlanSource* GlobalPlanCache::Fetch(const char *query_string, uint32 query_
                                                                      &foundCachedEntry);
 
     if (!foundCachedEntry) {
-        MemoryContextSwitchTo(oldcontext);
         LWLockRelease(GetMainLWLockByIndex(lock_id));
         return NULL;
     } else {
@@ -359,11 +380,11 @@ CachedPlanSource* GlobalPlanCache::Fetch(const char *query_string, uint32 query_
             return NULL;
         }
         psrc->gpc.status.AddRefcount();
-        if (ENABLE_DN_GPC)
-            u_sess->pcache_cxt.private_refcount++;
         pg_atomic_fetch_add_u32(&entry->val.used_count, 1);
-        MemoryContextSwitchTo(oldcontext);
+        pg_atomic_fetch_add_u64(&entry->val.hit_count, 1);
         LWLockRelease(GetMainLWLockByIndex(lock_id));
+        if (ENABLE_DN_GPC)
+            u_sess->pcache_cxt.private_refcount++;
         return psrc;
     }
 
@@ -385,6 +406,8 @@ void GlobalPlanCache::AddInvalidList(CachedPlanSource* plansource)
 
 void GlobalPlanCache::DropInvalid()
 {
+    List *drop_list = NIL;
+
     (void)LWLockAcquire(GPCClearLock, LW_EXCLUSIVE);
     if (m_invalid_list != NULL) {
         DListCell *cell = m_invalid_list->head;
@@ -395,15 +418,7 @@ void GlobalPlanCache::DropInvalid()
                 DListCell *next = cell->next;
                 GPC_LOG("drop invalid shared plancache", curr, curr->stmt_name);
                 m_invalid_list = dlist_delete_cell(m_invalid_list, cell, false);
-                DropCachedPlanInternal(curr);
-                curr->magic = 0;
-                MemoryContextUnSeal(curr->context);
-                MemoryContextUnSeal(curr->query_context);
-                if (curr->opFusionObj) {
-                    OpFusion::DropGlobalOpfusion((OpFusion*)(curr->opFusionObj));
-                }
-                MemoryContextDelete(curr->context);
-
+                drop_list = lappend(drop_list, curr);
                 cell = next;
             } else {
                 cell = cell->next;
@@ -411,6 +426,12 @@ void GlobalPlanCache::DropInvalid()
         }
     }
     LWLockRelease(GPCClearLock);
+
+    ListCell *lc = NULL;
+    foreach (lc, drop_list) {
+        GPCDestroyPlanSource((CachedPlanSource *)lfirst(lc));
+    }
+    list_free_ext(drop_list);
 }
 
 template<PlansourceInvalidAction action_type>
@@ -1004,6 +1025,7 @@ void GlobalPlanCache::CleanUpByTime()
 
         /* Step 2: Try to remove plan cache */
         if (gpckey_list && list_length(gpckey_list) > 0) {
+            List *drop_list = NIL;
             LWLockAcquire(GetMainLWLockByIndex(lock_id), LW_EXCLUSIVE);
             ListCell* l = NULL;
             foreach(l, gpckey_list) {
@@ -1016,15 +1038,8 @@ void GlobalPlanCache::CleanUpByTime()
                     if (cur_plansource->gpc.status.RefCountZero() &&
                         INSTR_TIME_GET_DOUBLE(curTime) - INSTR_TIME_GET_DOUBLE(entry->val.last_use_time) > GPC_CLEAN_WAIT_TIME) {
                         GPC_LOG("drop shared plancache by time", cur_plansource, cur_plansource->stmt_name);
-                        DropCachedPlanInternal(cur_plansource);
                         hash_search(m_array[bucket_id].hash_tbl, (void *) key, HASH_REMOVE, &found);
-                        cur_plansource->magic = 0;
-                        MemoryContextUnSeal(cur_plansource->context);
-                        MemoryContextUnSeal(cur_plansource->query_context);
-                        if (cur_plansource->opFusionObj) {
-                            OpFusion::DropGlobalOpfusion((OpFusion*)(cur_plansource->opFusionObj));
-                        }
-                        MemoryContextDelete(cur_plansource->context);
+                        drop_list = lappend(drop_list, cur_plansource);
                         m_array[bucket_id].count--;
                     }
                 }
@@ -1035,6 +1050,11 @@ void GlobalPlanCache::CleanUpByTime()
             }
             LWLockRelease(GetMainLWLockByIndex(lock_id));
 
+            /* unlinked with refcount zero, free them without blocking the bucket */
+            foreach(l, drop_list) {
+                GPCDestroyPlanSource((CachedPlanSource *)lfirst(l));
+            }
+            list_free_ext(drop_list);
             list_free_ext(gpckey_list);
         }
     }
@@ -101,10 +101,13 @@ GlobalPlanCache::GetStatus(uint32 *num)
             securec_check(rc, "\0", "\0");
             stat_array[index].params_num = ps->num_params;
             stat_array[index].func_id = entry->key.spi_signature.func_oid;
+            stat_array[index].hit_count = entry->val.hit_count;
+            stat_array[index].plan_time = ps->gpc.plan_time;
             bool printPlan = u_sess->attr.attr_sql.Debug_print_plan && entry->val.plansource->gplan &&
                              u_sess->proc_cxt.MyDatabaseId == entry->key.env.plainenv.database_id;
             if (printPlan) {
-                elog(LOG, "gpc query string: %s", stat_array[index].query);
+                elog(LOG, "gpc query string: %s, hits: %lu, plan time: %.3f ms", stat_array[index].query,
+                     stat_array[index].hit_count, stat_array[index].plan_time);
                 ListCell* lc = NULL;
                 foreach (lc, entry->val.plansource->gplan->stmt_list) {
                     Node* st = NULL;
@@ -135,6 +138,8 @@ GlobalPlanCache::GetStatus(uint32 *num)
             stat_array[index].schema_name = "";
             stat_array[index].params_num = 0;
             stat_array[index].func_id = curr->gpc.key->spi_signature.func_oid;
+            stat_array[index].hit_count = 0;
+            stat_array[index].plan_time = curr->gpc.plan_time;
             index++;
             cell = cell->next;
         }
@@ -167,6 +172,7 @@ GlobalPlanCache::GetStatus(uint32 *num)
 Datum GlobalPlanCache::PlanClean()
 {
     DListCell *cell = NULL;
+    List *drop_list = NIL;
 
     for (uint32 bucket_id = 0; bucket_id < GPC_NUM_OF_BUCKETS; bucket_id ++)
     {
@@ -188,15 +194,8 @@ Datum GlobalPlanCache::PlanClean()
             cur = entry->val.plansource;
             if(cur->gpc.status.RefCountZero()) {
                 bool found = false;
-                DropCachedPlanInternal(cur);
-                cur->magic = 0;
                 hash_search(m_array[bucket_id].hash_tbl, (void *) &(entry->key), HASH_REMOVE, &found);
-                MemoryContextUnSeal(cur->context);
-                MemoryContextUnSeal(cur->query_context);
-                if (cur->opFusionObj) {
-                    OpFusion::DropGlobalOpfusion((OpFusion*)(cur->opFusionObj));
-                }
-                MemoryContextDelete(cur->context);
+                drop_list = lappend(drop_list, cur);
                 m_array[bucket_id].count--;
             }
         }
@@ -210,11 +209,7 @@ Datum GlobalPlanCache::PlanClean()
             if (curr->gpc.status.RefCountZero()) {
                 DListCell *next = cell->next;
                 m_invalid_list = dlist_delete_cell(m_invalid_list, cell, false);
-                DropCachedPlanInternal(curr);
-                curr->magic = 0;
-                MemoryContextUnSeal(curr->context);
-                MemoryContextUnSeal(curr->query_context);
-                MemoryContextDelete(curr->context);
+                drop_list = lappend(drop_list, curr);
                 cell = next;
             } else {
                 cell = cell->next;
@@ -223,6 +218,13 @@ Datum GlobalPlanCache::PlanClean()
     }
     LWLockRelease(GPCClearLock);
 
+    /* all of them are unlinked with refcount zero, free them without holding any lock */
+    ListCell *lc = NULL;
+    foreach (lc, drop_list) {
+        GPCDestroyPlanSource((CachedPlanSource *)lfirst(lc));
+    }
+    list_free_ext(drop_list);
+
     PG_RETURN_BOOL(true);
 }
 
@@ -90,6 +90,7 @@
 #include "instruments/instr_slow_query.h"
 #include "instruments/instr_statement.h"
 #include "instruments/instr_handle_mgr.h"
+#include "instruments/latency_sketch.h"
 
 #ifdef ENABLE_UT
 #define static
@@ -2892,7 +2893,9 @@ void pgstat_initialize_session(void)
      * app name of thread pool worker might be over-written during session
      * guc initilization, need to restore it.
      */
-    pgstat_report_appname("ThreadPoolWorker");
+    if (strcmp((const char*)t_thrd.shemem_ptr_cxt.MyBEEntry->st_appname, "ThreadPoolWorker") != 0) {
+        pgstat_report_appname("ThreadPoolWorker");
+    }
     pgstat_report_activity(STATE_COUPLED, NULL);
 
     /* change stat object to session */
@@ -3032,6 +3035,7 @@ void pgstat_bestart(void)
     beentry->st_nodeid = -1;
     beentry->st_waitnode_count = 0;
     beentry->st_plannodeid = -1;
+    beentry->st_exec_plannodeid = -1;
     beentry->st_numnodes = -1;
     /* Initialize wait event information. */
     beentry->st_waitevent = WAIT_EVENT_END;
@@ -3405,6 +3409,8 @@ void pgstat_report_activity(BackendState state, const char* cmd_str)
 
     beentry->st_state = state;
     beentry->st_state_start_timestamp = current_timestamp;
+    /* a node left by an aborted query must not be charged with what comes next */
+    beentry->st_exec_plannodeid = -1;
 
     if (cmd_str != NULL) {
         rc = memcpy_s(
@@ -6905,28 +6911,15 @@ void pgstate_update_percentile_responsetime(void)
 
 void pgstat_update_responstime_singlenode(uint64 UniqueSQLId, int64 start_time, int64 rt)
 {
-    int32 sqlRTIndex;
-
     if (!u_sess->attr.attr_common.enable_instr_rt_percentile)
         return;
 
-    /* if the percentile thread is memory copying or memory is null, not record */
-    if (g_instance.stat_cxt.force_process != false || g_instance.stat_cxt.sql_rt_info_array == NULL) {
+    if (g_instance.stat_cxt.rt_sketch == NULL) {
         return;
     }
 
-    LWLockAcquire(PercentileLock, LW_SHARED);
-    /* if the current is full , not record this time, set force process to true to active percentile thread */
-    sqlRTIndex = gs_atomic_add_32(&g_instance.stat_cxt.sql_rt_info_array->sqlRTIndex, 1);
-    if ((sqlRTIndex >= MAX_SQL_RT_INFO_COUNT) || (sqlRTIndex < 0)) {
-        g_instance.stat_cxt.force_process = true;
-        LWLockRelease(PercentileLock);
-        return;
-    }
-    g_instance.stat_cxt.sql_rt_info_array->sqlRT[sqlRTIndex].UniqueSQLId = UniqueSQLId;
-    g_instance.stat_cxt.sql_rt_info_array->sqlRT[sqlRTIndex].start_time = start_time;
-    g_instance.stat_cxt.sql_rt_info_array->sqlRT[sqlRTIndex].rt = rt;
-    LWLockRelease(PercentileLock);
+    /* lock free, the percentile thread moves the counts out when it calculates */
+    LatencySketchAdd(g_instance.stat_cxt.rt_sketch, rt);
 }
 
 static void pgstat_recv_sql_responstime(PgStat_SqlRT* msg, int len)
@@ -7014,37 +7007,6 @@ static void prepare_calculate(SqlRTInfoArray* sql_rt_info, int* counter)
     qsort(u_sess->percentile_cxt.LocalsqlRT, sql_rt_info_count, sizeof(SqlRTInfo), sqlRTComparator);
 }
 
-static void prepare_calculate_single(const SqlRTInfoArray* sql_rt_info, int* counter)
-{
-    int32 sql_rt_info_count = g_instance.stat_cxt.sql_rt_info_array->sqlRTIndex;
-
-    if (sql_rt_info_count > MAX_SQL_RT_INFO_COUNT) {
-        sql_rt_info_count = MAX_SQL_RT_INFO_COUNT;
-    }
-
-    if (sql_rt_info_count == 0) {
-        *counter = sql_rt_info_count;
-        return;
-    }
-
-    if (u_sess->percentile_cxt.LocalsqlRT != NULL)
-        pfree(u_sess->percentile_cxt.LocalsqlRT);
-
-    u_sess->percentile_cxt.LocalsqlRT = (SqlRTInfo*)MemoryContextAllocZero(
-        SESS_GET_MEM_CXT_GROUP(MEMORY_CONTEXT_DFX), sql_rt_info_count * sizeof(SqlRTInfo));
-
-    LWLockAcquire(PercentileLock, LW_EXCLUSIVE);
-    errno_t ss_rc = memcpy_s(u_sess->percentile_cxt.LocalsqlRT,
-        sql_rt_info_count * sizeof(SqlRTInfo),
-        sql_rt_info->sqlRT,
-        sql_rt_info_count * sizeof(SqlRTInfo));
-    LWLockRelease(PercentileLock);
-    securec_check(ss_rc, "\0", "\0");
-    g_instance.stat_cxt.sql_rt_info_array->sqlRTIndex = 0;
-    g_instance.stat_cxt.force_process = false;
-    *counter = sql_rt_info_count;
-    qsort(u_sess->percentile_cxt.LocalsqlRT, sql_rt_info_count, sizeof(SqlRTInfo), sqlRTComparator);
-}
 
 /* ----------
  * pgstat_recv_memReserved() -
@@ -9441,11 +9403,7 @@ bool CalcSQLRowStatCounter(PgStat_TableCounts* last_total_counter, PgStat_TableC
 int pgstat_fetch_sql_rt_info_counter(void)
 {
     if (g_instance.stat_cxt.sql_rt_info_array != NULL) {
-        if (IS_SINGLE_NODE) {
-            prepare_calculate_single(g_instance.stat_cxt.sql_rt_info_array, &u_sess->percentile_cxt.LocalCounter);
-        } else {
-            prepare_calculate(g_instance.stat_cxt.sql_rt_info_array, &u_sess->percentile_cxt.LocalCounter);
-        }
+        prepare_calculate(g_instance.stat_cxt.sql_rt_info_array, &u_sess->percentile_cxt.LocalCounter);
     }
     return u_sess->percentile_cxt.LocalCounter;
 }
@@ -1950,6 +1950,9 @@ int PostmasterMain(int argc, char* argv[])
     /* core dump injection */
     bbox_initialize();
 
+    /* pick the clock used by wait event and statement instrumentation */
+    InitCycleClock();
+
     /*
      * Initialize stats collection subsystem (this does NOT start the
      * collector process!)
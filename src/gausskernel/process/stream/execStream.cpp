@@ -314,8 +314,7 @@ static StreamSharedContext* buildLocalStreamContext(Stream* streamNode, PlannedS
 
     StreamSharedContext* sharedContext = (StreamSharedContext*)palloc0(sizeof(StreamSharedContext));
     MemoryContext localStreamMemoryCtx = NULL;
-    VectorBatch*** sharedBatches = NULL;
-    TupleVector*** sharedTuples = NULL;
+    LocalStreamRing** rings = NULL;
     DataStatus** dataStatus = NULL;
     bool** is_connect_end = NULL;
     StringInfo** messages = NULL;
@@ -364,23 +363,15 @@ static StreamSharedContext* buildLocalStreamContext(Stream* streamNode, PlannedS
         }
     }
 
-    /* Init shared batches or tuples */
-    if (IsA((Plan*)streamNode, VecStream)) {
-        sharedBatches = (VectorBatch***)palloc0(sizeof(VectorBatch**) * consumerNum);
-        for (int i = 0; i < consumerNum; i++) {
-            sharedBatches[i] = (VectorBatch**)palloc0(sizeof(VectorBatch*) * producerNum);
-        }
-    } else {
-        sharedTuples = (TupleVector***)palloc0(sizeof(TupleVector**) * consumerNum);
-        for (int i = 0; i < consumerNum; i++) {
-            sharedTuples[i] = (TupleVector**)palloc0(sizeof(TupleVector*) * producerNum);
-        }
+    /* Init data rings, the slots are filled in by producers. */
+    rings = (LocalStreamRing**)palloc0(sizeof(LocalStreamRing*) * consumerNum);
+    for (int i = 0; i < consumerNum; i++) {
+        rings[i] = (LocalStreamRing*)palloc0(sizeof(LocalStreamRing) * producerNum);
     }
 
     sharedContext->vectorized = IsA(&(streamNode->scan.plan), VecStream);
     sharedContext->localStreamMemoryCtx = localStreamMemoryCtx;
-    sharedContext->sharedBatches = sharedBatches;
-    sharedContext->sharedTuples = sharedTuples;
+    sharedContext->rings = rings;
     sharedContext->dataStatus = dataStatus;
     sharedContext->is_connect_end = is_connect_end;
     sharedContext->messages = messages;
@@ -414,7 +405,14 @@ static void resetLocalStreamContext(StreamSharedContext* context)
     context->is_connect_end[0][0] = false;
     resetStringInfo(context->messages[0][0]);
 
-    context->sharedTuples[0][0]->tuplePointer = 0;
+    LocalStreamRing* ring = &context->rings[0][0];
+    ring->head = 0;
+    ring->tail = 0;
+    for (int i = 0; i < LOCAL_STREAM_RING_SIZE; i++) {
+        if (ring->tuples[i] != NULL) {
+            ring->tuples[i]->tuplePointer = 0;
+        }
+    }
 }
 
 static RecursiveUnion* GetRecursiveUnionSubPlan(PlannedStmt* pstmt, int subplanid)
@@ -351,6 +351,7 @@ StreamNodeGroup::StreamNodeGroup()
     m_streamConsumerList = NULL;
     m_streamProducerList = NULL;
     m_syncControllers = NIL;
+    m_scanCursors = NULL;
     m_streamRuntimeContext = NULL;
     m_streamArray = NULL;
     m_quitWaitCond = 0;
@@ -1065,6 +1066,12 @@ void StreamNodeGroup::deInit(StreamObjStatus status)
         m_syncControllers = NIL;
     }
 
+    /* Cursors not released by every worker, e.g. after an error, go with the table */
+    if (m_scanCursors != NULL) {
+        hash_destroy(m_scanCursors);
+        m_scanCursors = NULL;
+    }
+
     m_streamRuntimeContext = NULL;
 
     /*
@@ -1642,6 +1649,100 @@ SyncController* StreamNodeGroup::GetSyncController(int controller_plannodeid)
     return result;
 }
 
+/*
+ * @Function: GetParallelScanCursor()
+ *
+ * @Description: fetch the shared morsel cursor of the scan_no'th scan that
+ * the given plan node starts on relid, the cursor is created on first use.
+ * All smp workers of a seq scan start the same sequence of scans, so they
+ * end up pulling block ranges from the same cursor. Each worker must give
+ * the cursor back with ReleaseParallelScanCursor() once it is done with it.
+ *
+ * @param[IN] plannodeid: plan node id of the seq scan
+ * @param[IN] relid: relation or partition oid to scan
+ * @param[IN] scan_no: how many scans the worker has started on this node
+ * @param[IN] dop: number of workers sharing the cursor
+ *
+ * @return: cursor counting morsels handed out so far, NULL if not available
+ */
+volatile uint32* StreamNodeGroup::GetParallelScanCursor(int plannodeid, Oid relid, int scan_no, int dop)
+{
+    ParallelScanCursor* cursor = NULL;
+    ParallelScanCursorKey key;
+    bool found = false;
+
+    if (m_streamRuntimeContext == NULL) {
+        return NULL;
+    }
+
+    errno_t rc = memset_s(&key, sizeof(key), 0, sizeof(key));
+    securec_check(rc, "\0", "\0");
+    key.plan_node_id = plannodeid;
+    key.relid = relid;
+    key.scan_no = scan_no;
+
+    AutoMutexLock streamLock(&m_recursiveMutex);
+    streamLock.lock();
+
+    if (m_scanCursors == NULL) {
+        HASHCTL ctl;
+        rc = memset_s(&ctl, sizeof(ctl), 0, sizeof(ctl));
+        securec_check(rc, "\0", "\0");
+        ctl.keysize = sizeof(ParallelScanCursorKey);
+        ctl.entrysize = sizeof(ParallelScanCursor);
+        ctl.hash = tag_hash;
+        ctl.hcxt = m_streamRuntimeContext;
+        m_scanCursors =
+            hash_create("parallel scan cursor hash", 64, &ctl, HASH_ELEM | HASH_FUNCTION | HASH_SHRCTX);
+    }
+
+    cursor = (ParallelScanCursor*)hash_search(m_scanCursors, &key, HASH_ENTER, &found);
+    if (!found) {
+        cursor->pending_workers = dop;
+        cursor->next_morsel = 0;
+    }
+
+    streamLock.unLock();
+
+    return &cursor->next_morsel;
+}
+
+/*
+ * @Function: ReleaseParallelScanCursor()
+ *
+ * @Description: a worker is done with the cursor returned by
+ * GetParallelScanCursor(), the cursor is dropped when the last worker
+ * releases it.
+ *
+ * @param[IN] plannodeid: plan node id of the seq scan
+ * @param[IN] relid: relation or partition oid of the scan
+ * @param[IN] scan_no: scan number the cursor was fetched with
+ *
+ * @return: void
+ */
+void StreamNodeGroup::ReleaseParallelScanCursor(int plannodeid, Oid relid, int scan_no)
+{
+    ParallelScanCursorKey key;
+
+    errno_t rc = memset_s(&key, sizeof(key), 0, sizeof(key));
+    securec_check(rc, "\0", "\0");
+    key.plan_node_id = plannodeid;
+    key.relid = relid;
+    key.scan_no = scan_no;
+
+    AutoMutexLock streamLock(&m_recursiveMutex);
+    streamLock.lock();
+
+    if (m_scanCursors != NULL) {
+        ParallelScanCursor* cursor = (ParallelScanCursor*)hash_search(m_scanCursors, &key, HASH_FIND, NULL);
+        if (cursor != NULL && --cursor->pending_workers <= 0) {
+            (void)hash_search(m_scanCursors, &key, HASH_REMOVE, NULL);
+        }
+    }
+
+    streamLock.unLock();
+}
+
 /*
  * Mark executor stop flag for all sync controller
  */
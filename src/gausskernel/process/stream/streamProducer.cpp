@@ -97,6 +97,7 @@ StreamProducer::StreamProducer(
     m_disQuickLocator = NULL;
     m_sharedContext = NULL;
     m_sharedContextInit = false;
+    m_localRowStart = NULL;
     m_broadcastSize = 0;
     m_threadInit = false;
     m_uniqueSQLId = 0;
@@ -178,6 +179,7 @@ StreamProducer::~StreamProducer()
     m_subConsumerList = NULL;
     m_tempBuffer = NULL;
     m_colsType = NULL;
+    m_localRowStart = NULL;
     m_desc = NULL;
     m_consumerNodes = NULL;
     m_bucketMap = NULL;
@@ -992,8 +994,28 @@ void StreamProducer::localRedistributeStream(VectorBatch* batch)
 
     (this->*m_channelCalVecFun)(batch);
 
+    /* Group the rows by channel, so that each channel gets its rows in one go. */
+    int* start = m_localRowStart;
+    errno_t rc = memset_s(start, sizeof(int) * (m_connNum + 1), 0, sizeof(int) * (m_connNum + 1));
+    securec_check(rc, "\0", "\0");
+
     for (int i = 0; i < batch->m_rows; i++) {
-        sendByMemory(NULL, batch, m_locator[i], i);
+        start[m_locator[i] + 1]++;
+    }
+    for (int i = 0; i < m_connNum; i++) {
+        start[i + 1] += start[i];
+    }
+    for (int i = 0; i < batch->m_rows; i++) {
+        m_localRows[start[m_locator[i]]++] = i;
+    }
+
+    /* Now start[i] is the end of channel i's rows. */
+    int begin = 0;
+    for (int i = 0; i < m_connNum; i++) {
+        if (start[i] > begin) {
+            sendRowsByMemory(batch, i, m_localRows + begin, start[i] - begin);
+        }
+        begin = start[i];
     }
 }
 
@@ -1743,33 +1765,60 @@ void StreamProducer::sendByMemory(TupleTableSlot* tuple, VectorBatch* batchSrc,
 {
     if (m_sharedContextInit) {
         gs_memory_send(tuple, batchSrc, m_sharedContext, nthChannel, nthRow);
+        checkLocalConsumerEnd();
+    } else {
+        for (int i = 0; i < m_connNum; i++)
+            gs_memory_disconnect(m_sharedContext, i);
+    }
+}
 
-        bool allInValid = true;
-
-        /*
-         * Check if the connections have been closed by all the consumers when
-         * the SQL is like 'limit XXX', then we should not try to send data
-         * anymore, and quit now.
-         */
-        for (int i = 0; i < m_connNum; i++) {
-            if (!m_sharedContext->is_connect_end[i][u_sess->stream_cxt.smp_id]) {
-                allInValid = false;
-                break;
-            }
-        }
+/*
+ * @Description: Send some rows of a batch by memory for local stream.
+ *
+ * parameter[IN] batchSrc: batch to send.
+ * parameter[IN] nthChannel: the dest receiver NO.
+ * parameter[IN] rows: the locations of data in the batch.
+ * parameter[IN] nrows: number of rows to send.
 
-        /*
-         * don't set stop flag under LOCAL GATHER for MPP Recusive, we need
-         * Recusive finish all sync steps, even if consumer return NULL early.
-         */
-        if (allInValid && !m_streamNode->is_recursive_local)
-            u_sess->exec_cxt.executorStopFlag = true;
+ * @return: void
+ */
+void StreamProducer::sendRowsByMemory(VectorBatch* batchSrc, int nthChannel, const int* rows, int nrows)
+{
+    if (m_sharedContextInit) {
+        gs_memory_send_rows(batchSrc, m_sharedContext, nthChannel, rows, nrows);
+        checkLocalConsumerEnd();
     } else {
         for (int i = 0; i < m_connNum; i++)
             gs_memory_disconnect(m_sharedContext, i);
     }
 }
 
+/*
+ * @Description: Check if the connections have been closed by all the consumers when
+ *				 the SQL is like 'limit XXX', then we should not try to send data
+ *				 anymore, and quit now.
+ *
+ * @return: void
+ */
+void StreamProducer::checkLocalConsumerEnd()
+{
+    bool allInValid = true;
+
+    for (int i = 0; i < m_connNum; i++) {
+        if (!m_sharedContext->is_connect_end[i][u_sess->stream_cxt.smp_id]) {
+            allInValid = false;
+            break;
+        }
+    }
+
+    /*
+     * don't set stop flag under LOCAL GATHER for MPP Recusive, we need
+     * Recusive finish all sync steps, even if consumer return NULL early.
+     */
+    if (allInValid && !m_streamNode->is_recursive_local)
+        u_sess->exec_cxt.executorStopFlag = true;
+}
+
 /*
  * @Description: When all the data has been send to consumer, give a signal to
  *				 the consumer.
@@ -1795,21 +1844,31 @@ void StreamProducer::initSharedContext()
         return;
 
     if (m_sharedContext->vectorized) {
-        /* Init batches. */
+        /*
+         * Init batches. They are handed over to the consumer without copy, so allocate
+         * them in the shared context which outlives this thread.
+         */
+        MemoryContext sharedCxt = m_sharedContext->localStreamMemoryCtx;
         for (int i = 0; i < m_connNum; i++) {
-            m_sharedContext->sharedBatches[i][u_sess->stream_cxt.smp_id] =
-                New(CurrentMemoryContext) VectorBatch(CurrentMemoryContext, m_desc);
+            LocalStreamRing* ring = &m_sharedContext->rings[i][u_sess->stream_cxt.smp_id];
+            for (int k = 0; k < LOCAL_STREAM_RING_SIZE; k++) {
+                ring->batches[k] = New(sharedCxt) VectorBatch(sharedCxt, m_desc);
+            }
         }
+        m_localRowStart = (int*)palloc0(sizeof(int) * (m_connNum + 1));
     } else {
         /* Init tuples. */
         for (int i = 0; i < m_connNum; i++) {
-            TupleVector* TupleVec = (TupleVector*)palloc0(sizeof(TupleVector));
-            TupleVec->tupleVector = (TupleTableSlot**)palloc0(sizeof(TupleTableSlot*) * TupleVectorMaxSize);
-            m_sharedContext->sharedTuples[i][u_sess->stream_cxt.smp_id] = TupleVec;
-
-            for (int j = 0; j < TupleVectorMaxSize; j++) {
-                TupleVec->tupleVector[j] = MakeTupleTableSlot(false);
-                ExecSetSlotDescriptor(TupleVec->tupleVector[j], m_desc);
+            LocalStreamRing* ring = &m_sharedContext->rings[i][u_sess->stream_cxt.smp_id];
+            for (int k = 0; k < LOCAL_STREAM_RING_SIZE; k++) {
+                TupleVector* TupleVec = (TupleVector*)palloc0(sizeof(TupleVector));
+                TupleVec->tupleVector = (TupleTableSlot**)palloc0(sizeof(TupleTableSlot*) * TupleVectorMaxSize);
+                ring->tuples[k] = TupleVec;
+
+                for (int j = 0; j < TupleVectorMaxSize; j++) {
+                    TupleVec->tupleVector[j] = MakeTupleTableSlot(false);
+                    ExecSetSlotDescriptor(TupleVec->tupleVector[j], m_desc);
+                }
             }
         }
     }
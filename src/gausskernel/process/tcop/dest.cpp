@@ -307,8 +307,19 @@ void ReadyForQuery(CommandDest dest)
             } else if (PG_PROTOCOL_MAJOR(FrontendProtocol) >= 2)
                 pq_putemptymessage('Z');
 
-            /* Flush output at end of cycle in any case. */
-            pq_flush();
+            /*
+             * Flush output at end of cycle, unless a pipelining client already
+             * sent the whole next batch. Its results will be flushed together
+             * with ours, saving a send per batch. The deferral is bounded: at
+             * most PQ_MAX_DEFERRED_FLUSHES batches are held back, and
+             * pq_flush_deferred() sends them before we wait on a lock or read
+             * from an empty socket. A thread pool worker keeps the session
+             * while unconsumed input is buffered (see
+             * WorkerThreadCanSeekAnotherMission), and CleanThread() flushes
+             * anyway.
+             */
+            if (PG_PROTOCOL_MAJOR(FrontendProtocol) < 3 || !pq_defer_flush())
+                pq_flush();
 
             break;
 
@@ -371,6 +371,7 @@ static void knl_g_stat_init(knl_g_stat_context* stat_cxt)
     stat_cxt->RTPERCENTILE[1] = 0;
     stat_cxt->NodeStatResetTime = 0;
     stat_cxt->sql_rt_info_array = NULL;
+    stat_cxt->rt_sketch = NULL;
 
     stat_cxt->gInstanceTimeInfo = (int64*)MemoryContextAllocZero(
         INSTANCE_GET_MEM_CXT_GROUP(MEMORY_CONTEXT_DFX), TOTAL_TIME_INFO_TYPES * sizeof(int64));
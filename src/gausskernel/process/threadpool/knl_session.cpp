@@ -1176,6 +1176,8 @@ void knl_session_init(knl_session_context* sess_cxt)
     DLInitElem(&sess_cxt->elem, sess_cxt);
 
     sess_cxt->attachPid = InvalidTid;
+    sess_cxt->group = NULL;
+    sess_cxt->detachStamp = 0;
     sess_cxt->top_transaction_mem_cxt = NULL;
     sess_cxt->self_mem_cxt = NULL;
     sess_cxt->temp_mem_cxt = NULL;
@@ -678,6 +678,9 @@ static void knl_t_basebackup_init(knl_t_basebackup_context* basebackup_cxt)
     int rc = memset_s(basebackup_cxt->g_xlog_location, MAXPGPATH, 0, MAXPGPATH);
     securec_check(rc, "\0", "\0");
     basebackup_cxt->buf_block = NULL;
+    basebackup_cxt->compress = false;
+    basebackup_cxt->compress_buf = NULL;
+    basebackup_cxt->compress_buf_size = 0;
 }
 
 static void knl_t_datarcvwriter_init(knl_t_datarcvwriter_context* datarcvwriter_cxt)
@@ -1080,6 +1083,7 @@ static void knl_t_libpq_init(knl_t_libpq_context* libpq_cxt)
     securec_check(rc, "\0", "\0");
     libpq_cxt->PqSendBuffer = NULL;
     libpq_cxt->PqCommBusy = false;
+    libpq_cxt->PqDeferredFlushes = 0;
     libpq_cxt->DoingCopyOut = false;
 
     libpq_cxt->save_query_result_to_disk = false;
@@ -1127,6 +1131,10 @@ static void knl_t_walreceiver_init(knl_t_walreceiver_context* walreceiver_cxt)
     walreceiver_cxt->AmWalReceiverForFailover = false;
     walreceiver_cxt->AmWalReceiverForStandby = false;
     walreceiver_cxt->control_file_writed = 0;
+    walreceiver_cxt->wal_decompress_buf = NULL;
+    walreceiver_cxt->wal_decompress_buf_size = 0;
+    walreceiver_cxt->wal_decompress_dict = NULL;
+    walreceiver_cxt->wal_decompress_dict_len = 0;
 }
 
 static void knl_t_storage_init(knl_t_storage_context* storage_cxt)
@@ -1270,12 +1278,22 @@ static void knl_t_walsender_init(knl_t_walsender_context* walsender_cxt)
     walsender_cxt->Demotion = NoDemote;
     walsender_cxt->wake_wal_senders = false;
     walsender_cxt->wal_send_completed = false;
+    walsender_cxt->sync_release_pending = false;
     walsender_cxt->sendFile = -1;
     walsender_cxt->sendSegNo = 0;
     walsender_cxt->sendOff = 0;
     walsender_cxt->sentPtr = 0;
     walsender_cxt->catchup_threshold = 0;
     walsender_cxt->output_xlog_msg_prefix_len = 0;
+    walsender_cxt->wal_compress = false;
+    walsender_cxt->wal_compress_stream = NULL;
+    walsender_cxt->wal_compress_buf = NULL;
+    walsender_cxt->wal_compress_buf_size = 0;
+    walsender_cxt->wal_compress_dict = NULL;
+    walsender_cxt->wal_compress_dict_len = 0;
+    walsender_cxt->wal_compress_raw_bytes = 0;
+    walsender_cxt->wal_compress_sent_bytes = 0;
+    walsender_cxt->wal_compress_time_us = 0;
     walsender_cxt->output_data_msg_cur_len = 0;
     walsender_cxt->output_data_msg_start_xlog = InvalidXLogRecPtr;
     walsender_cxt->output_data_msg_end_xlog = InvalidXLogRecPtr;
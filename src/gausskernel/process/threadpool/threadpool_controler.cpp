@@ -63,6 +63,11 @@ ThreadPoolControler* g_threadPoolControler = NULL;
 
 #define BUFSIZE 128
 
+/* numa_distance() reports the distance of a node to itself as 10 */
+#define NUMA_LOCAL_DISTANCE 10
+/* steal threshold between groups on different nodes when the distance is unknown */
+#define DEFAULT_REMOTE_STEAL_THRESHOLD 2
+
 #define IS_NULL_STR(str) ((str) == NULL || (str)[0] == '\0')
 #define INVALID_ATTR_ERROR(detail) \
     ereport(FATAL, (errcode(ERRCODE_OPERATE_INVALID_PARAM), errmsg("Invalid attribute for thread pool."), detail))
@@ -76,6 +81,8 @@ ThreadPoolControler::ThreadPoolControler()
     m_groupNum = 1;
     m_threadNum = 0;
     m_maxPoolSize = 0;
+    m_stealThreshold = NULL;
+    m_stealCursor = 0;
 }
 
 ThreadPoolControler::~ThreadPoolControler()
@@ -86,6 +93,7 @@ ThreadPoolControler::~ThreadPoolControler()
     m_threadPoolContext = NULL;
     m_groups = NULL;
     m_sessCtrl = NULL;
+    m_stealThreshold = NULL;
 }
 
 void ThreadPoolControler::Init(bool enableNumaDistribute)
@@ -153,6 +161,8 @@ void ThreadPoolControler::Init(bool enableNumaDistribute)
         m_groups[i]->WaitReady();
     }
 
+    InitStealThreshold(bindCpu);
+
 #ifdef __USE_NUMA
     if (enableNumaDistribute) {
         /* Set to interleave mode for other than worker thread */
@@ -164,6 +174,96 @@ void ThreadPoolControler::Init(bool enableNumaDistribute)
     m_scheduler->StartUp();
 }
 
+/*
+ * Workers steal sessions from groups on the same numa node as soon as one is
+ * waiting, but a remote group must have a backlog in proportion to the numa
+ * distance, so that a short burst does not drag sessions across nodes.
+ */
+void ThreadPoolControler::InitStealThreshold(bool bindCpu)
+{
+    m_stealThreshold = (int*)palloc(sizeof(int) * m_groupNum * m_groupNum);
+
+    for (int thief = 0; thief < m_groupNum; thief++) {
+        for (int victim = 0; victim < m_groupNum; victim++) {
+            int thiefNode = m_groups[thief]->GetNumaId();
+            int victimNode = m_groups[victim]->GetNumaId();
+            int threshold = 1;
+
+            if (bindCpu && thiefNode != victimNode && thiefNode >= 0 && victimNode >= 0) {
+                threshold = DEFAULT_REMOTE_STEAL_THRESHOLD;
+#ifdef __USE_NUMA
+                int distance = (numa_available() < 0) ? 0 : numa_distance(thiefNode, victimNode);
+                if (distance > NUMA_LOCAL_DISTANCE) {
+                    threshold = distance / NUMA_LOCAL_DISTANCE;
+                }
+#endif
+            }
+            m_stealThreshold[thief * m_groupNum + victim] = threshold;
+        }
+    }
+}
+
+/*
+ * Called by the listener of the thief group when one of its workers has
+ * nothing to do. Pick the first group, in round robin order, whose ready
+ * session list is long enough for the numa distance and take its oldest
+ * session.
+ */
+knl_session_context* ThreadPoolControler::StealSession(ThreadPoolGroup* thief)
+{
+    if (m_groupNum <= 1 || m_stealThreshold == NULL) {
+        return NULL;
+    }
+
+    int thiefId = thief->GetGroupId();
+    int start = (int)(pg_atomic_fetch_add_u32(&m_stealCursor, 1) % (uint32)m_groupNum);
+    for (int i = 0; i < m_groupNum; i++) {
+        ThreadPoolGroup* victim = m_groups[(start + i) % m_groupNum];
+        if (victim == thief ||
+            victim->GetWaitServeSessionCount() < m_stealThreshold[thiefId * m_groupNum + victim->GetGroupId()]) {
+            continue;
+        }
+
+        knl_session_context* session = victim->GetListener()->StealReadySession();
+        if (session != NULL) {
+            (void)pg_atomic_fetch_add_u64(&thief->m_stealInCount, 1);
+            (void)pg_atomic_fetch_add_u64(&victim->m_stealOutCount, 1);
+            return session;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Called by the listener of the home group when it has no free worker for a
+ * session. Hand the session to an idle worker of another group if the local
+ * backlog, including this session, reaches the steal threshold.
+ */
+bool ThreadPoolControler::HandOffSession(ThreadPoolGroup* home, knl_session_context* session)
+{
+    if (m_groupNum <= 1 || m_stealThreshold == NULL) {
+        return false;
+    }
+
+    int homeId = home->GetGroupId();
+    int backlog = home->GetWaitServeSessionCount() + 1;
+    int start = (int)(pg_atomic_fetch_add_u32(&m_stealCursor, 1) % (uint32)m_groupNum);
+    for (int i = 0; i < m_groupNum; i++) {
+        ThreadPoolGroup* thief = m_groups[(start + i) % m_groupNum];
+        if (thief == home || thief->m_idleWorkerNum <= 0 ||
+            backlog < m_stealThreshold[thief->GetGroupId() * m_groupNum + homeId]) {
+            continue;
+        }
+
+        if (thief->GetListener()->TryHandOffSession(session)) {
+            (void)pg_atomic_fetch_add_u64(&thief->m_stealInCount, 1);
+            (void)pg_atomic_fetch_add_u64(&home->m_stealOutCount, 1);
+            return true;
+        }
+    }
+    return false;
+}
+
 void ThreadPoolControler::SetThreadPoolInfo()
 {
     InitCpuInfo();
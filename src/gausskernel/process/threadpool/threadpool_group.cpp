@@ -72,6 +72,11 @@ ThreadPoolGroup::ThreadPoolGroup(int maxWorkerNum, int expectWorkerNum, int maxS
       m_sessionCount(0),
       m_waitServeSessionCount(0),
       m_processTaskCount(0),
+      m_queueWaitCount(0),
+      m_queueWaitTotalUs(0),
+      m_queueWaitMaxUs(0),
+      m_stealInCount(0),
+      m_stealOutCount(0),
       m_groupId(groupId),
       m_numaId(numaId),
       m_groupCpuNum(cpuNum),
@@ -210,10 +215,14 @@ void ThreadPoolGroup::GetThreadPoolGroupStat(ThreadPoolStat* stat)
     int runSessionNum = m_workerNum - m_idleWorkerNum;
     int idleSessionNum = m_sessionCount - m_waitServeSessionCount - runSessionNum;
     idleSessionNum = (idleSessionNum < 0) ? 0 : idleSessionNum;
+    uint64 waitCount = pg_atomic_read_u64(&m_queueWaitCount);
+    uint64 avgWaitUs = (waitCount == 0) ? 0 : (pg_atomic_read_u64(&m_queueWaitTotalUs) / waitCount);
     rc = sprintf_s(stat->sessionInfo, STATUS_INFO_SIZE,
-            "total: %d waiting: %d running:%d idle: %d",
+            "total: %d waiting: %d running:%d idle: %d "
+            "queue wait avg(us): %lu max(us): %lu steal in: %lu steal out: %lu",
             m_sessionCount, m_waitServeSessionCount,
-            runSessionNum, idleSessionNum);
+            runSessionNum, idleSessionNum, avgWaitUs, pg_atomic_read_u64(&m_queueWaitMaxUs),
+            pg_atomic_read_u64(&m_stealInCount), pg_atomic_read_u64(&m_stealOutCount));
     securec_check_ss(rc, "", "");
 
     if (IS_PGXC_DATANODE) {
@@ -356,6 +365,28 @@ bool ThreadPoolGroup::IsGroupHang()
     return ishang;
 }
 
+/*
+ * Account the time a session spent in the ready session list of this group,
+ * enqueueTime is set by the listener when the session is queued.
+ */
+void ThreadPoolGroup::RecordQueueWait(const instr_time* enqueueTime)
+{
+    instr_time waitTime;
+    INSTR_TIME_SET_CURRENT(waitTime);
+    INSTR_TIME_SUBTRACT(waitTime, *enqueueTime);
+    uint64 waitUs = INSTR_TIME_GET_MICROSEC(waitTime);
+
+    (void)pg_atomic_fetch_add_u64(&m_queueWaitCount, 1);
+    (void)pg_atomic_fetch_add_u64(&m_queueWaitTotalUs, waitUs);
+
+    uint64 maxUs = pg_atomic_read_u64(&m_queueWaitMaxUs);
+    while (waitUs > maxUs) {
+        if (pg_atomic_compare_exchange_u64(&m_queueWaitMaxUs, &maxUs, waitUs)) {
+            break;
+        }
+    }
+}
+
 void ThreadPoolGroup::AttachThreadToCPU(ThreadId thread, int cpu)
 {
     cpu_set_t cpuset;
@@ -180,12 +180,23 @@ bool ThreadPoolListener::TryFeedWorker(ThreadPoolWorker* worker)
 {
     Dlelem* sc = m_readySessionList->RemoveHead();
     if (sc != NULL) {
-        worker->SetSession((knl_session_context*)sc->dle_val);
+        knl_session_context* session = (knl_session_context*)sc->dle_val;
+        worker->SetSession(session);
         pg_atomic_fetch_sub_u32((volatile uint32*)&m_group->m_waitServeSessionCount, 1);
         pg_atomic_fetch_add_u32((volatile uint32*)&m_group->m_processTaskCount, 1);
+        m_group->RecordQueueWait(&session->last_access_time);
+        return true;
+    }
+
+    /* Nothing to do in our group, help an overloaded group before going idle. */
+    knl_session_context* stolen = g_threadPoolControler->StealSession(m_group);
+    if (stolen != NULL) {
+        worker->SetSession(stolen);
+        pg_atomic_fetch_add_u32((volatile uint32*)&m_group->m_processTaskCount, 1);
         return true;
     } else {
-        m_freeWorkerList->AddTail(&worker->m_elem);
+        /* LIFO, the worker went idle last has the warmest cache and likely the state of the last session. */
+        m_freeWorkerList->AddHead(&worker->m_elem);
         pg_atomic_fetch_add_u32((volatile uint32*)&m_group->m_idleWorkerNum, 1);
         return false;
     }
@@ -193,6 +204,7 @@ bool ThreadPoolListener::TryFeedWorker(ThreadPoolWorker* worker)
 
 void ThreadPoolListener::AddNewSession(knl_session_context* session)
 {
+    session->group = m_group;
     AddEpoll(session);
     (void)pg_atomic_fetch_add_u32((volatile uint32*)&m_group->m_sessionCount, 1);
     ereport(DEBUG2, 
@@ -320,6 +332,9 @@ void ThreadPoolListener::DispatchSession(knl_session_context* session)
                 pg_atomic_fetch_add_u32((volatile uint32*)&m_group->m_processTaskCount, 1);
                 break;
            }
+        } else if (g_threadPoolControler->HandOffSession(m_group, session)) {
+            /* A worker of another group takes the session, it still belongs to our epoll. */
+            break;
         } else {
             INSTR_TIME_SET_CURRENT(session->last_access_time);
 
@@ -336,6 +351,41 @@ void ThreadPoolListener::DispatchSession(knl_session_context* session)
     }
 }
 
+/*
+ * Take the oldest ready session for a worker of another group. Called by
+ * ThreadPoolControler::StealSession when the victim group has enough backlog.
+ */
+knl_session_context* ThreadPoolListener::StealReadySession()
+{
+    Dlelem* sc = m_readySessionList->RemoveHead();
+    if (sc == NULL) {
+        return NULL;
+    }
+
+    knl_session_context* session = (knl_session_context*)sc->dle_val;
+    pg_atomic_fetch_sub_u32((volatile uint32*)&m_group->m_waitServeSessionCount, 1);
+    m_group->RecordQueueWait(&session->last_access_time);
+    return session;
+}
+
+/*
+ * Give a session of another group to one of our idle workers.
+ * Return false if there is no idle worker in this group.
+ */
+bool ThreadPoolListener::TryHandOffSession(knl_session_context* session)
+{
+    while (true) {
+        Dlelem* sc = m_freeWorkerList->RemoveHead();
+        if (sc == NULL) {
+            return false;
+        }
+        if (((ThreadPoolWorker*)DLE_VAL(sc))->WakeUpToWork(session)) {
+            pg_atomic_fetch_add_u32((volatile uint32*)&m_group->m_processTaskCount, 1);
+            return true;
+        }
+    }
+}
+
 void ThreadPoolListener::DelSessionFromEpoll(knl_session_context* session)
 {
     epoll_ctl(m_epollFd, EPOLL_CTL_DEL, session->proc_cxt.MyProcPort->sock, NULL);
@@ -73,6 +73,9 @@ static void SendSessionIdxToClient();
 static void ResetSignalHandle();
 static void SessionSetBackendOptions();
 
+/* source of session detach stamps, unique over all workers and sessions, 0 is never used */
+static volatile uint64 g_sessionDetachStamp = 0;
+
 ThreadPoolWorker::ThreadPoolWorker(uint idx, ThreadPoolGroup* group, pthread_mutex_t* mutex, pthread_cond_t* cond)
 {
     m_idx = idx;
@@ -80,6 +83,7 @@ ThreadPoolWorker::ThreadPoolWorker(uint idx, ThreadPoolGroup* group, pthread_mut
     m_tid = InvalidTid;
     m_threadStatus = THREAD_UNINIT;
     m_currentSession = NULL;
+    m_lastDetachStamp = 0;
     m_mutex = mutex;
     m_cond = cond;
     m_waitState = STATE_WAIT_UNDEFINED;
@@ -89,6 +93,7 @@ ThreadPoolWorker::ThreadPoolWorker(uint idx, ThreadPoolGroup* group, pthread_mut
 ThreadPoolWorker::~ThreadPoolWorker()
 {
     m_currentSession = NULL;
+    m_lastDetachStamp = 0;
     m_group = NULL;
     m_mutex = NULL;
     m_cond = NULL;
@@ -393,6 +398,7 @@ void ThreadPoolWorker::ShutDownIfNecessary()
             u_sess = m_currentSession;
         }
 
+        m_lastDetachStamp = 0;
         RestoreThreadVariable();
         proc_exit(0);
     }
@@ -469,9 +475,11 @@ void ThreadPoolWorker::DetachSessionFromThread()
     pgstat_couple_decouple_session(false);
     pgstat_deinitialize_session();
     m_currentSession->attachPid = (ThreadId)-1;
+    m_currentSession->detachStamp = pg_atomic_add_fetch_u64(&g_sessionDetachStamp, 1);
+    m_lastDetachStamp = m_currentSession->detachStamp;
 
-    /* should restore the data before return to listener. */
-    m_group->GetListener()->AddEpoll(m_currentSession);
+    /* should restore the data before return to the listener of the group owning this session. */
+    m_currentSession->group->GetListener()->AddEpoll(m_currentSession);
     m_currentSession = NULL;
     u_sess = NULL;
 }
@@ -482,10 +490,22 @@ bool ThreadPoolWorker::AttachSessionToThread()
     Assert(t_thrd.utils_cxt.TopTransactionResourceOwner == NULL);
 
     SetSessionInfo();
-    RestoreThreadVariable();
-    if (m_currentSession->status == KNL_SESS_DETACH) {
-        RestoreLocaleInfo();
+    /*
+     * Thread local variables and locale are saved back to the session at detach,
+     * so they are still valid if this worker was the last one to detach the session.
+     * Every detach gets a new stamp, so a session served by another worker in between,
+     * or a new session at the address of a freed one, does not match.
+     * As free workers are reused in LIFO order, a session sending statements
+     * in a row is often served by the same worker.
+     */
+    if (m_lastDetachStamp == 0 || m_currentSession->detachStamp != m_lastDetachStamp ||
+        m_currentSession->status != KNL_SESS_DETACH) {
+        RestoreThreadVariable();
+        if (m_currentSession->status == KNL_SESS_DETACH) {
+            RestoreLocaleInfo();
+        }
     }
+    m_lastDetachStamp = 0;
 
     u_sess = m_currentSession;
     t_thrd.postgres_cxt.whereToSendOutput = DestRemote;
@@ -576,6 +596,7 @@ void ThreadPoolWorker::CleanUpSession(bool threadexit)
     }
 
     if (m_currentSession->status != KNL_SESS_END_PHASE1) {
+        m_lastDetachStamp = 0;
         InitThreadLocalWhenSessionExit();
 
         if (!threadexit) {
@@ -583,7 +604,7 @@ void ThreadPoolWorker::CleanUpSession(bool threadexit)
         }
 
         /* Close Session. */
-        m_group->GetListener()->DelSessionFromEpoll(m_currentSession);
+        m_currentSession->group->GetListener()->DelSessionFromEpoll(m_currentSession);
 
         if (m_currentSession->proc_cxt.PassConnLimit) {
             SpinLockAcquire(&g_instance.conn_cxt.ConnCountLock);
@@ -121,6 +121,7 @@
 #include "optimizer/ml_model.h"
 #include "vecexecutor/vecstream.h"
 #include "miscadmin.h"
+#include "pgstat.h"
 #include "vecexecutor/vecnodecstorescan.h"
 #include "vecexecutor/vecnodecstoreindexscan.h"
 #include "vecexecutor/vecnodedfsindexscan.h"
@@ -748,6 +749,7 @@ void ExecProcNodeInstr(PlanState* node, TupleTableSlot* result)
 TupleTableSlot* ExecProcNode(PlanState* node)
 {
     TupleTableSlot* result = NULL;
+    int oldPlanNodeId = -1;
 
     CHECK_FOR_INTERRUPTS();
     MemoryContext old_context;
@@ -768,12 +770,21 @@ TupleTableSlot* ExecProcNode(PlanState* node)
         InstrStartNode(node->instrument);
     }
 
+    /* let ASP samples tell which operator the time is spent in */
+    if (u_sess->attr.attr_common.enable_asp) {
+        oldPlanNodeId = pgstat_report_exec_plannode(node->plan->plan_node_id);
+    }
+
     if (unlikely(planstate_need_stub(node))) {
         result = ExecProcNodeStub(node);
     } else {
         result = ExecProcNodeByType(node);
     }
 
+    if (u_sess->attr.attr_common.enable_asp) {
+        (void)pgstat_report_exec_plannode(oldPlanNodeId);
+    }
+
     if (node->instrument != NULL) {
         ExecProcNodeInstr(node, result);
     }
@@ -802,6 +813,7 @@ Node* MultiExecProcNode(PlanState* node)
 {
     Node* result = NULL;
     MemoryContext old_context;
+    int oldPlanNodeId = -1;
 
     CHECK_FOR_INTERRUPTS();
 
@@ -812,6 +824,10 @@ Node* MultiExecProcNode(PlanState* node)
         ExecReScan(node);       /* let ReScan handle this */
     }
 
+    if (u_sess->attr.attr_common.enable_asp) {
+        oldPlanNodeId = pgstat_report_exec_plannode(node->plan->plan_node_id);
+    }
+
     switch (nodeTag(node)) {
             /*
              * Only node types that actually support multiexec will be listed
@@ -841,6 +857,10 @@ Node* MultiExecProcNode(PlanState* node)
             break;
     }
 
+    if (u_sess->attr.attr_common.enable_asp) {
+        (void)pgstat_report_exec_plannode(oldPlanNodeId);
+    }
+
     /* Print Operator Memory for Hash operator */
     if (node->instrument) {
         node->instrument->memoryinfo.operatorMemory = node->plan->operatorMemKB[0];
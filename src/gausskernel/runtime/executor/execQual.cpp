@@ -55,6 +55,7 @@
 #include "pgstat.h"
 #include "utils/acl.h"
 #include "utils/builtins.h"
+#include "utils/fmgrtab.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
 #include "utils/typcache.h"
@@ -108,6 +109,9 @@ static Datum ExecMakeFunctionResultNoSets(
     FuncExprState* fcache, ExprContext* econtext, bool* isNull, ExprDoneCond* isDone);
 static Datum ExecEvalFunc(FuncExprState* fcache, ExprContext* econtext, bool* isNull, ExprDoneCond* isDone);
 static Datum ExecEvalOper(FuncExprState* fcache, ExprContext* econtext, bool* isNull, ExprDoneCond* isDone);
+static int ExecInitOperVarConst(FuncExprState* fcache);
+template <int varArg>
+static Datum ExecEvalOperVarConst(FuncExprState* fcache, ExprContext* econtext, bool* isNull, ExprDoneCond* isDone);
 static Datum ExecEvalDistinct(FuncExprState* fcache, ExprContext* econtext, bool* isNull, ExprDoneCond* isDone);
 static Datum ExecEvalScalarArrayOp(
     ScalarArrayOpExprState* sstate, ExprContext* econtext, bool* isNull, ExprDoneCond* isDone);
@@ -2820,6 +2824,85 @@ static Datum ExecEvalFunc(FuncExprState* fcache, ExprContext* econtext, bool* is
     }
 }
 
+/*
+ * Check whether an operator can be evaluated by ExecEvalOperVarConst: a strict,
+ * non-set builtin function with two arguments, one of them a non-null Const.
+ * If so, store the constant into fcinfo once and return the position of the
+ * other argument, otherwise return -1.
+ */
+static int ExecInitOperVarConst(FuncExprState* fcache)
+{
+    FmgrInfo* flinfo = &fcache->func;
+    const FmgrBuiltin* fbp = NULL;
+
+    if (!flinfo->fn_strict || flinfo->fn_retset || flinfo->fn_fenced || list_length(fcache->args) != 2)
+        return -1;
+
+    /* only builtins are free of the SPI and statistics bookkeeping skipped below */
+    fbp = fmgr_isbuiltin(flinfo->fn_oid);
+    if (fbp == NULL || fbp->func != flinfo->fn_addr)
+        return -1;
+
+    ExprState* left = (ExprState*)linitial(fcache->args);
+    ExprState* right = (ExprState*)lsecond(fcache->args);
+    int constArg;
+    if (IsA(right->expr, Const))
+        constArg = 1;
+    else if (IsA(left->expr, Const))
+        constArg = 0;
+    else
+        return -1;
+
+    Const* con = (Const*)(constArg == 1 ? right->expr : left->expr);
+    if (con->constisnull)
+        return -1;
+
+    FunctionCallInfo fcinfo = &fcache->fcinfo_data;
+    InitFunctionCallInfoArgs(*fcinfo, 2, 1);
+    fcinfo->argTypes[0] = left->resultType;
+    fcinfo->argTypes[1] = right->resultType;
+    fcinfo->arg[constArg] = con->constvalue;
+    fcinfo->argnull[constArg] = false;
+
+    return 1 - constArg;
+}
+
+/*
+ * ExecEvalOperVarConst
+ *
+ * Fused evaluation of "expr op Const" and "Const op expr", the most common
+ * shape of scan and join quals. The constant was loaded into fcinfo by
+ * ExecInitOperVarConst, so per row only the other argument is evaluated
+ * before the builtin is called directly.
+ */
+template <int varArg>
+static Datum ExecEvalOperVarConst(FuncExprState* fcache, ExprContext* econtext, bool* isNull, ExprDoneCond* isDone)
+{
+    FunctionCallInfo fcinfo = &fcache->fcinfo_data;
+    ExprState* argstate = (ExprState*)(varArg == 0 ? linitial(fcache->args) : lsecond(fcache->args));
+    Datum result;
+
+    /* Guard against stack overflow due to overly complex expressions */
+    check_stack_depth();
+
+    if (isDone != NULL)
+        *isDone = ExprSingleResult;
+
+    econtext->plpgsql_estate = plpgsql_estate;
+    plpgsql_estate = NULL;
+
+    fcinfo->arg[varArg] = ExecEvalExpr(argstate, econtext, &fcinfo->argnull[varArg], NULL);
+    if (fcinfo->argnull[varArg]) {
+        *isNull = true;
+        return (Datum)0;
+    }
+
+    fcinfo->isnull = false;
+    result = FunctionCallInvoke(fcinfo);
+    *isNull = fcinfo->isnull;
+    return result;
+}
+
 /* ----------------------------------------------------------------
  *		ExecEvalOper
  * ----------------------------------------------------------------
@@ -2891,6 +2974,14 @@ static Datum ExecEvalOper(FuncExprState* fcache, ExprContext* econtext, bool* is
                 fcache->xprstate.evalfunc = (ExprStateEvalFunc)ExecMakeFunctionResultNoSets<false, true>;
                 return ExecMakeFunctionResultNoSets<false, true>(fcache, econtext, isNull, isDone);
             } else {
+                int varArg = ExecInitOperVarConst(fcache);
+                if (varArg == 0) {
+                    fcache->xprstate.evalfunc = (ExprStateEvalFunc)ExecEvalOperVarConst<0>;
+                    return ExecEvalOperVarConst<0>(fcache, econtext, isNull, isDone);
+                } else if (varArg == 1) {
+                    fcache->xprstate.evalfunc = (ExprStateEvalFunc)ExecEvalOperVarConst<1>;
+                    return ExecEvalOperVarConst<1>(fcache, econtext, isNull, isDone);
+                }
                 fcache->xprstate.evalfunc = (ExprStateEvalFunc)ExecMakeFunctionResultNoSets<false, false>;
                 return ExecMakeFunctionResultNoSets<false, false>(fcache, econtext, isNull, isDone);
             }
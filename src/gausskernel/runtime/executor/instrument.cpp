@@ -482,7 +482,7 @@ void InstrStartNode(Instrumentation* instr)
 
     if (instr->need_timer) {
         if (INSTR_TIME_IS_ZERO(instr->starttime)) {
-            INSTR_TIME_SET_CURRENT(instr->starttime);
+            INSTR_TIME_SET_CYCLE_CLOCK(instr->starttime);
         } else {
             elog(DEBUG2, "InstrStartNode called twice in a row");
         }
@@ -544,7 +544,7 @@ void InstrStopNode(Instrumentation* instr, double n_tuples)
             return;
         }
 
-        INSTR_TIME_SET_CURRENT(end_time);
+        INSTR_TIME_SET_CYCLE_CLOCK(end_time);
         INSTR_TIME_ACCUM_DIFF(instr->counter, end_time, instr->starttime);
 
         INSTR_TIME_SET_ZERO(instr->starttime);
@@ -644,7 +644,7 @@ void InstrStartStream(StreamTime* instr)
 {
     if (instr->need_timer) {
         if (INSTR_TIME_IS_ZERO(instr->starttime)) {
-            INSTR_TIME_SET_CURRENT(instr->starttime);
+            INSTR_TIME_SET_CYCLE_CLOCK(instr->starttime);
         } else {
             elog(DEBUG2, "InstrStartNode called twice in a row");
         }
@@ -665,7 +665,7 @@ void InstrStopStream(StreamTime* instr, double n_tuples)
             return;
         }
 
-        INSTR_TIME_SET_CURRENT(end_time);
+        INSTR_TIME_SET_CYCLE_CLOCK(end_time);
         INSTR_TIME_ACCUM_DIFF(instr->counter, end_time, instr->starttime);
 
         INSTR_TIME_SET_ZERO(instr->starttime);
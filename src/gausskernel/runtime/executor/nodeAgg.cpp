@@ -144,6 +144,7 @@
 #include "utils/syscache.h"
 #include "utils/tuplesort.h"
 #include "utils/datum.h"
+#include "utils/dynahash.h"
 #include "utils/memprot.h"
 #include "workload/workload.h"
 
@@ -171,6 +172,9 @@ static void agg_fill_hash_table(AggState* aggstate);
 static TupleTableSlot* agg_retrieve_hash_table(AggState* aggstate);
 static TupleTableSlot* agg_retrieve(AggState* node);
 static bool prepare_data_source(AggState* node);
+static void agg_check_respill(AggState* aggstate);
+static void agg_close_overflow_source(AggWriteFileControl* TempFileControl);
+static void agg_reset_respill(AggWriteFileControl* TempFileControl);
 static TupleTableSlot* fetch_input_tuple(AggState* aggstate);
 
 /*
@@ -1298,7 +1302,8 @@ static AggHashEntry lookup_hash_entry(AggState* aggstate, TupleTableSlot* inputs
         hashslot->tts_isnull[varNumber] = inputslot->tts_isnull[varNumber];
     }
 
-    if (TempFileControl->spillToDisk == false || TempFileControl->finishwrite == true) {
+    if (TempFileControl->spillToDisk == false ||
+        (TempFileControl->finishwrite == true && TempFileControl->respill == false)) {
         /* find or create the hashtable entry using the filtered tuple */
         entry = (AggHashEntry)LookupTupleHashEntry(aggstate->hashtable, hashslot, &isnew, true);
     } else {
@@ -1311,6 +1316,10 @@ static AggHashEntry lookup_hash_entry(AggState* aggstate, TupleTableSlot* inputs
         if (entry) {
             /* initialize aggregates for new tuple group */
             initialize_aggregates(aggstate, aggstate->peragg, entry->pergroup);
+            if (TempFileControl->strategy == DIST_HASHAGG) {
+                agg_check_respill(aggstate);
+                return entry;
+            }
             agg_spill_to_disk(TempFileControl,
                             aggstate->hashtable,
                             aggstate->hashslot,
@@ -1324,7 +1333,8 @@ static AggHashEntry lookup_hash_entry(AggState* aggstate, TupleTableSlot* inputs
                 TempFileControl->filesource->m_spill_size = &aggstate->ss.ps.instrument->sorthashinfo.spill_size;
             }
         } else { /* this slot is new, it need be inserted to temp file */
-            Assert(TempFileControl->spillToDisk == true && TempFileControl->finishwrite == false);
+            Assert(TempFileControl->spillToDisk == true &&
+                   (TempFileControl->finishwrite == false || TempFileControl->respill == true));
             uint32 hashvalue;
             MinimalTuple tuple = ExecFetchSlotMinimalTuple(inputslot);
             MemoryContext oldContext;
@@ -1335,7 +1345,13 @@ static AggHashEntry lookup_hash_entry(AggState* aggstate, TupleTableSlot* inputs
             oldContext = MemoryContextSwitchTo(aggstate->tmpcontext->ecxt_per_tuple_memory);
             hashvalue = ComputeHashValue(aggstate->hashtable);
             MemoryContextSwitchTo(oldContext);
-            TempFileControl->filesource->writeTup(tuple, hashvalue & (TempFileControl->filenum - 1));
+            if (TempFileControl->respill) {
+                /* use the hash bits above those the current temp file was partitioned by */
+                TempFileControl->overflowsource->writeTup(tuple,
+                    (hashvalue >> TempFileControl->overflowshift) & (TempFileControl->overflowfilenum - 1));
+            } else {
+                TempFileControl->filesource->writeTup(tuple, hashvalue & (TempFileControl->filenum - 1));
+            }
         }
     } else if (((Agg *)aggstate->ss.ps.plan)->unique_check) {
         ereport(ERROR,
@@ -1375,6 +1391,8 @@ static bool prepare_data_source(AggState* node)
                 TempFileControl->filesource->setCurrentIdx(currfileidx);
                 MemoryContextResetAndDeleteChildren(node->aggcontexts[0]);
                 build_hash_table(node);
+                TempFileControl->inmemoryRownum = 0;
+                TempFileControl->respill = false;
 
                 TempFileControl->filesource->rewind(currfileidx);
                 node->table_filled = false;
@@ -1387,7 +1405,19 @@ static bool prepare_data_source(AggState* node)
             }
         }
         if (TempFileControl->curfile == TempFileControl->filenum) {
-            return false;
+            if (TempFileControl->overflowsource == NULL) {
+                return false;
+            }
+
+            /* all temp files are done, go on with the groups respilled from them */
+            TempFileControl->filesource->freeFileSource();
+            TempFileControl->filesource = TempFileControl->overflowsource;
+            TempFileControl->filenum = TempFileControl->overflowfilenum;
+            TempFileControl->hashshift = TempFileControl->overflowshift;
+            TempFileControl->overflowsource = NULL;
+            TempFileControl->overflowfilenum = 0;
+            TempFileControl->curfile = -1;
+            return prepare_data_source(node);
         }
     } else {
         Assert(false);
@@ -2597,6 +2627,9 @@ AggState* ExecInitAgg(Agg* node, EState* estate, int eflags)
     TempFilePara->m_hashAggSource = NULL;
     TempFilePara->maxMem = maxMem * 1024L;
     TempFilePara->spreadNum = 0;
+    TempFilePara->overflowsource = NULL;
+    TempFilePara->spillTimes = 0;
+    agg_reset_respill(TempFilePara);
     aggstate->aggTempFileControl = TempFilePara;
     return aggstate;
 }
@@ -2628,6 +2661,7 @@ void ExecEndAgg(AggState* node)
         }
         file->freeFileSource();
     }
+    agg_close_overflow_source(TempFileControl);
 
     /*
      * Clean up sort_slot first before tuplesort_end(node->sort_in)
@@ -2800,6 +2834,7 @@ void ExecReScanAgg(AggState* node)
          * set to null in the first rescan.
          */
         TempFileControl->filesource = NULL;
+        agg_close_overflow_source(TempFileControl);
 
         /* Rebuild an empty hash table */
         build_hash_table(node);
@@ -2816,6 +2851,8 @@ void ExecReScanAgg(AggState* node)
         TempFilePara->filenum = 0;
         TempFilePara->maxMem = maxMem * 1024L;
         TempFilePara->spreadNum = 0;
+        TempFilePara->spillTimes = 0;
+        agg_reset_respill(TempFilePara);
     } else {
         /*
          * Reset the per-group state (in particular, mark transvalues null)
@@ -2974,6 +3011,98 @@ FORCE_INLINE void agg_spill_to_disk(AggWriteFileControl* TempFileControl, TupleH
     }
 }
 
+/*
+ * agg_check_respill
+ *	  Account a group created while aggregating a temp file. If the temp file does
+ *	  not fit in memory either, the tuples of groups that are not in the hash table
+ *	  yet are partitioned again into overflow temp files by the next bits of their
+ *	  hash value. The overflow files are aggregated after the current ones, so this
+ *	  recurses until every partition fits in memory or the hash bits run out.
+ */
+static void agg_check_respill(AggState* aggstate)
+{
+    AggWriteFileControl* TempFileControl = (AggWriteFileControl*)aggstate->aggTempFileControl;
+    TupleHashTable hashtable = aggstate->hashtable;
+    AllocSetContext* set = (AllocSetContext*)(hashtable->tablecxt);
+    Plan* plan = aggstate->ss.ps.plan;
+    Instrumentation* instrument = aggstate->ss.ps.instrument;
+
+    TempFileControl->inmemoryRownum++;
+    int64 usedSize = set->totalSpace + TempFileControl->inmemoryRownum * hashtable->entrysize;
+    if (usedSize < TempFileControl->totalMem) {
+        return;
+    }
+
+    if (TempFileControl->overflowsource == NULL) {
+        const int hashbits = (int)(sizeof(uint32) * BITS_PER_BYTE);
+        hashFileSource* filesource = TempFileControl->filesource;
+        int shift = TempFileControl->hashshift + my_log2(TempFileControl->filenum);
+
+        /* no hash bits left to split the groups, keep them in memory */
+        if (shift >= hashbits) {
+            return;
+        }
+
+        int64 rows = filesource->getCurrentIdxRownum(TempFileControl->inmemoryRownum);
+        int filenum = getPower2Num((int)Min(rows / TempFileControl->inmemoryRownum, HASH_MAX_FILENUMBER));
+        filenum = Max(2, filenum);
+        if (shift + my_log2(filenum) > hashbits) {
+            filenum = 1 << (hashbits - shift);
+        }
+
+        MEMCTL_LOG(LOG,
+            "HashAgg(%d) respill temp file %d, its rows: %ld, rows in memory: %ld, respill file num: %d.",
+            plan->plan_node_id,
+            filesource->getCurrentIdx(),
+            filesource->m_rownum[filesource->getCurrentIdx()],
+            TempFileControl->inmemoryRownum,
+            filenum);
+
+        TempFileControl->overflowsource = New(CurrentMemoryContext) hashFileSource(aggstate->hashslot, filenum);
+        TempFileControl->overflowfilenum = filenum;
+        TempFileControl->overflowshift = shift;
+        if (instrument != NULL) {
+            TempFileControl->overflowsource->m_spill_size = &instrument->sorthashinfo.spill_size;
+        }
+
+        TempFileControl->spillTimes++;
+        if (TempFileControl->spillTimes == WARNING_SPILL_TIME) {
+            t_thrd.shemem_ptr_cxt.mySessionMemoryEntry->warning |= (1 << WLM_WARN_SPILL_TIMES_LARGE);
+        }
+        if (instrument != NULL) {
+            instrument->sorthashinfo.hash_spillNum++;
+            instrument->sorthashinfo.hash_FileNum += filenum;
+            if (TempFileControl->spillTimes == WARNING_SPILL_TIME) {
+                instrument->warning |= (1 << WLM_WARN_SPILL_TIMES_LARGE);
+            }
+        }
+    }
+
+    TempFileControl->respill = true;
+}
+
+/*
+ * agg_close_overflow_source
+ *	  Close and free the overflow temp files, if any.
+ */
+static void agg_close_overflow_source(AggWriteFileControl* TempFileControl)
+{
+    if (TempFileControl->overflowsource != NULL) {
+        TempFileControl->overflowsource->closeAll();
+        TempFileControl->overflowsource->freeFileSource();
+        TempFileControl->overflowsource = NULL;
+    }
+}
+
+static void agg_reset_respill(AggWriteFileControl* TempFileControl)
+{
+    Assert(TempFileControl->overflowsource == NULL);
+    TempFileControl->hashshift = 0;
+    TempFileControl->respill = false;
+    TempFileControl->overflowfilenum = 0;
+    TempFileControl->overflowshift = 0;
+}
+
 /*
  * @Description: Early free the memory for Aggregation.
  *
@@ -2998,6 +3127,7 @@ void ExecEarlyFreeAggregation(AggState* node)
         }
         file->freeFileSource();
     }
+    agg_close_overflow_source(TempFileControl);
 
     /*
      * Clean up sort_slot first before tuplesort_end(node->sort_in)
@@ -3152,6 +3282,7 @@ void ExecReSetAgg(AggState* node)
          * set to null in the first rescan.
          */
         TempFileControl->filesource = NULL;
+        agg_close_overflow_source(TempFileControl);
 
         /* Rebuild an empty hash table */
         build_hash_table(node);
@@ -3168,6 +3299,8 @@ void ExecReSetAgg(AggState* node)
         TempFilePara->filenum = 0;
         TempFilePara->maxMem = maxMem * 1024L;
         TempFilePara->spreadNum = 0;
+        TempFilePara->spillTimes = 0;
+        agg_reset_respill(TempFilePara);
     } else {
         /*
          * Reset the per-group state (in particular, mark transvalues null)
@@ -54,6 +54,7 @@ static void ExecHashBuildSkewHash(HashJoinTable hashtable, Hash* node, int mcvsT
 static void ExecHashSkewTableInsert(HashJoinTable hashtable, TupleTableSlot* slot, uint32 hashvalue, int bucketNumber);
 static void ExecHashRemoveNextSkewBucket(HashJoinTable hashtable);
 static void ExecHashIncreaseBuckets(HashJoinTable hashtable);
+static void ExecHashIncreaseNumBuckets(HashJoinTable hashtable);
 
 static void* dense_alloc(HashJoinTable hashtable, Size size);
 /* ----------------------------------------------------------------
@@ -142,6 +143,10 @@ Node* MultiExecHash(HashState* node)
     }
     (void)pgstat_report_waitstatus(oldStatus);
 
+    /* resize the hash table if the inner side had more rows than the planner estimated */
+    if (hashtable->nbuckets != hashtable->nbuckets_optimal)
+        ExecHashIncreaseNumBuckets(hashtable);
+
     /* analysis hash table information created in memory */
     if (anls_opt_is_on(ANLS_HASH_CONFLICT))
         ExecHashTableStats(hashtable, node->ps.plan->plan_node_id);
@@ -321,6 +326,8 @@ HashJoinTable ExecHashTableCreate(Hash* node, List* hashOperators, bool keepNull
     hashtable = (HashJoinTable)palloc(sizeof(HashJoinTableData));
     hashtable->nbuckets = nbuckets;
     hashtable->log2_nbuckets = log2_nbuckets;
+    hashtable->nbuckets_optimal = nbuckets;
+    hashtable->log2_nbuckets_optimal = log2_nbuckets;
     hashtable->buckets = NULL;
     hashtable->keepNulls = keepNulls;
     hashtable->skewEnabled = false;
@@ -339,6 +346,7 @@ HashJoinTable ExecHashTableCreate(Hash* node, List* hashOperators, bool keepNull
     hashtable->spaceUsed = 0;
     hashtable->spacePeak = 0;
     hashtable->spill_count = 0;
+    hashtable->sysBusyCheckSpace = 0;
     hashtable->spaceAllowed = local_work_mem * 1024L;
 
     hashtable->spaceUsedSkew = 0;
@@ -993,6 +1001,15 @@ static void ExecHashIncreaseNumBatches(HashJoinTable hashtable)
 
     hashtable->nbatch = nbatch;
 
+    /*
+     * Batch numbers are taken from the hash bits above the bucket bits, so the
+     * number of buckets is fixed from now on. Growing the bucket array here
+     * would take memory right when we are short of it, so give up the growth
+     * planned while loading the first batch.
+     */
+    hashtable->nbuckets_optimal = hashtable->nbuckets;
+    hashtable->log2_nbuckets_optimal = hashtable->log2_nbuckets;
+
     /*
      * Scan through the existing hash table entries and dump out any that are
      * no longer of the current batch.
@@ -1130,6 +1147,19 @@ void ExecHashTableInsert(
         hashTuple->next = hashtable->buckets[bucketno];
         hashtable->buckets[bucketno] = hashTuple;
 
+        /*
+         * Increase the optimal number of buckets once we exceed NTUP_PER_BUCKET,
+         * the table is resized when the build finishes. Only possible while
+         * there's a single batch, see ExecHashIncreaseNumBatches.
+         */
+        if (hashtable->nbatch == 1 &&
+            hashtable->totalTuples + 1 > (double)hashtable->nbuckets_optimal * NTUP_PER_BUCKET &&
+            hashtable->nbuckets_optimal <= INT_MAX / 2 &&
+            (Size)hashtable->nbuckets_optimal * 2 <= MaxAllocSize / sizeof(HashJoinTuple)) {
+            hashtable->nbuckets_optimal *= 2;
+            hashtable->log2_nbuckets_optimal += 1;
+        }
+
         /* Record the total width and total tuples for first batch until spill */
         if (hashtable->width[0] >= 0) {
             hashtable->width[0]++;
@@ -1141,8 +1171,20 @@ void ExecHashTableInsert(
         if (hashtable->spaceUsed > hashtable->spacePeak) {
             hashtable->spacePeak = hashtable->spaceUsed;
         }
-        bool sysBusy = gs_sysmemory_busy(hashtable->spaceUsed * dop, false);
-        if (hashtable->spaceUsed > hashtable->spaceAllowed || sysBusy) {
+        /*
+         * The process memory counters are shared by all threads, looking at
+         * them for every tuple makes the build of SMP workers contend with
+         * each other. Check once per chunk of memory instead.
+         */
+        bool sysBusy = false;
+        if (hashtable->spaceUsed - hashtable->sysBusyCheckSpace >= HASH_CHUNK_SIZE ||
+            hashtable->spaceUsed < hashtable->sysBusyCheckSpace) {
+            hashtable->sysBusyCheckSpace = hashtable->spaceUsed;
+            sysBusy = gs_sysmemory_busy(hashtable->spaceUsed * dop, false);
+        }
+        /* the bucket array is resized to the optimal size when the build finishes, count it in */
+        if (hashtable->spaceUsed + (int64)(hashtable->nbuckets_optimal * sizeof(HashJoinTuple)) >
+            hashtable->spaceAllowed || sysBusy) {
             AllocSetContext* set = (AllocSetContext*)(hashtable->hashCxt);
             if (sysBusy) {
                 hashtable->causedBySysRes = true;
@@ -1973,6 +2015,68 @@ static void ExecHashIncreaseBuckets(HashJoinTable hashtable)
 
     hashtable->nbuckets = hashtable->nbuckets * 2;
     hashtable->log2_nbuckets++;
+    if (hashtable->nbuckets_optimal < hashtable->nbuckets) {
+        hashtable->nbuckets_optimal = hashtable->nbuckets;
+        hashtable->log2_nbuckets_optimal = hashtable->log2_nbuckets;
+    }
+}
+
+/*
+ *		ExecHashIncreaseNumBuckets
+ *
+ *		Resize the bucket array of a single batch hash table to the optimal
+ *		size after the build, so that probes don't walk long bucket chains
+ *		when the planner underestimated the inner side. All tuples live in
+ *		the dense chunks, so the buckets are rebuilt by scanning those.
+ */
+static void ExecHashIncreaseNumBuckets(HashJoinTable hashtable)
+{
+    errno_t rc;
+
+    /* do nothing if not an increase */
+    if (hashtable->nbuckets >= hashtable->nbuckets_optimal)
+        return;
+
+    /* bucket and batch numbers share the hash bits, see ExecHashIncreaseNumBatches */
+    Assert(hashtable->nbatch == 1);
+
+#ifdef HJDEBUG
+    printf("Increasing nbuckets %d => %d\n", hashtable->nbuckets, hashtable->nbuckets_optimal);
+#endif
+
+    hashtable->nbuckets = hashtable->nbuckets_optimal;
+    hashtable->log2_nbuckets = hashtable->log2_nbuckets_optimal;
+
+    hashtable->buckets =
+        (HashJoinTuple*)repalloc(hashtable->buckets, sizeof(HashJoinTuple) * hashtable->nbuckets);
+    rc = memset_s(hashtable->buckets,
+        sizeof(HashJoinTuple) * hashtable->nbuckets,
+        0,
+        sizeof(HashJoinTuple) * hashtable->nbuckets);
+    securec_check(rc, "\0", "\0");
+
+    for (HashMemoryChunk chunk = hashtable->chunks; chunk != NULL; chunk = chunk->next) {
+        /* position within the buffer (up to chunk->used) */
+        size_t idx = 0;
+
+        while (idx < chunk->used) {
+            HashJoinTuple hashTuple = (HashJoinTuple)(chunk->data + idx);
+            int bucketno;
+            int batchno;
+
+            ExecHashGetBucketAndBatch(hashtable, hashTuple->hashvalue, &bucketno, &batchno);
+
+            /* add the tuple to the proper bucket */
+            hashTuple->next = hashtable->buckets[bucketno];
+            hashtable->buckets[bucketno] = hashTuple;
+
+            /* advance index past the tuple */
+            idx += MAXALIGN(HJTUPLE_OVERHEAD + HJTUPLE_MINTUPLE(hashTuple)->t_len);
+        }
+
+        /* allow this loop to be cancellable */
+        CHECK_FOR_INTERRUPTS();
+    }
 }
 
 void ExecHashTableStats(HashJoinTable hashtable, int planid)
@@ -371,7 +371,9 @@ NestLoopState* ExecInitNestLoop(NestLoop* node, EState* estate, int eflags)
         eflags |= EXEC_FLAG_REWIND;
     else
         eflags &= ~EXEC_FLAG_REWIND;
+    estate->es_under_rescan_inner++;
     innerPlanState(nlstate) = ExecInitNode(innerPlan(node), estate, eflags);
+    estate->es_under_rescan_inner--;
 
     /*
      * tuple table initialization
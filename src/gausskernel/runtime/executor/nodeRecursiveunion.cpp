@@ -463,7 +463,9 @@ RecursiveUnionState* ExecInitRecursiveUnion(RecursiveUnion* node, EState* estate
      * initialize child nodes
      */
     outerPlanState(rustate) = ExecInitNode(outerPlan(node), estate, eflags);
+    estate->es_under_rescan_inner++;
     innerPlanState(rustate) = ExecInitNode(innerPlan(node), estate, eflags);
+    estate->es_under_rescan_inner--;
 
     /*
      * If hashing, precompute fmgr lookup data for inner loop, and create the
@@ -27,6 +27,7 @@
 
 #include "access/relscan.h"
 #include "access/tableam.h"
+#include "distributelayer/streamCore.h"
 #include "executor/execdebug.h"
 #include "executor/nodeModifyTable.h"
 #include "executor/nodeSamplescan.h"
@@ -179,6 +180,8 @@ void Start_Prefetch(TableScanDesc scan, SeqScanAccessor* p_accessor, ScanDirecti
 static TupleTableSlot* SeqNext(SeqScanState* node);
 
 static void ExecInitNextPartitionForSeqScan(SeqScanState* node);
+static void InitParallelSeqScan(SeqScanState* node, TableScanDesc scan, bool useMorsel);
+static void ReleaseParallelSeqScan(SeqScanState* node);
 
 /* ----------------------------------------------------------------
  *						Scan Support
@@ -529,9 +532,15 @@ SeqScanState* ExecInitSeqScan(SeqScan* node, EState* estate, int eflags)
      * initialize scan relation
      */
     InitSeqNextMtd(node, scanstate);
+    /*
+     * Workers can only pair up their morsel cursors if they run the same scans.
+     * A scan that is rescanned for every outer row or subplan call is run for
+     * different rows in every worker, so it keeps the static block split.
+     */
+    scanstate->parallelScanMorsel = (eflags & (EXEC_FLAG_REWIND | EXEC_FLAG_BACKWARD | EXEC_FLAG_MARK)) == 0 &&
+        !estate->es_under_subplan && estate->es_under_rescan_inner == 0;
     if (IsValidScanDesc(scanstate->ss_currentScanDesc)) {
-        scan_handler_tbl_init_parallel_seqscan(scanstate->ss_currentScanDesc, 
-            scanstate->ps.plan->dop, scanstate->partScanDirection);
+        InitParallelSeqScan(scanstate, scanstate->ss_currentScanDesc, scanstate->parallelScanMorsel);
     } else {
         scanstate->ps.stubType = PST_Scan;
     }
@@ -595,6 +604,7 @@ void ExecEndSeqScan(SeqScanState* node)
     if (scanDesc != NULL) {
         scan_handler_tbl_endscan((TableScanDesc)scanDesc, relation);
     }
+    ReleaseParallelSeqScan(node);
     if (node->isPartTbl) {
         if (PointerIsValid(node->partitions)) {
             Assert(node->ss_currentPartition);
@@ -638,6 +648,9 @@ void ExecReScanSeqScan(SeqScanState* node)
         (((RowTableSample*)node->sampleScanInfo.tsm_state)->resetSampleScan)();
     }
 
+    /* only moving on to the next partition is the same scan in every worker */
+    bool nextPartition = false;
+
     scan = node->ss_currentScanDesc;
     if (node->isPartTbl) {
         if (PointerIsValid(node->partitions)) {
@@ -648,12 +661,13 @@ void ExecReScanSeqScan(SeqScanState* node)
             ExecInitNextPartitionForSeqScan(node);
 
             scan = node->ss_currentScanDesc;
+            nextPartition = true;
         }
     } else {
         scan_handler_tbl_rescan(scan, NULL, node->ss_currentRelation);
     }
 
-    scan_handler_tbl_init_parallel_seqscan(scan, node->ps.plan->dop, node->partScanDirection);
+    InitParallelSeqScan(node, scan, node->parallelScanMorsel && nextPartition);
     ExecScanReScan((ScanState*)node);
 }
 
@@ -694,6 +708,53 @@ void ExecSeqRestrPos(SeqScanState* node)
     scan_handler_tbl_restrpos(node->ss_currentScanDesc);
 }
 
+/*
+ * Split the blocks of a heap scan among the smp workers of this plan node.
+ * Plain heap scans pull small block ranges from a cursor shared by all workers,
+ * so skewed pages or filters do not leave one worker scanning the tail alone.
+ * Only the first scan and partition advances use a cursor: every worker runs
+ * those in the same order, which is how the scan number pairs their cursors up.
+ * Any other rescan keeps the static split.
+ */
+static void InitParallelSeqScan(SeqScanState* node, TableScanDesc scan, bool useMorsel)
+{
+    int dop = node->ps.plan->dop;
+
+    /* the previous scan of this worker is over, it no longer needs its cursor */
+    ReleaseParallelSeqScan(node);
+
+    if (useMorsel && dop > 1 && u_sess->stream_cxt.global_obj != NULL && !node->isSampleScan &&
+        !RELATION_OWN_BUCKET(scan->rs_rd) && scan->rs_rd->rd_tam_type == TAM_HEAP &&
+        !g_instance.attr.attr_storage.enable_adio_function) {
+        volatile uint32* cursor = u_sess->stream_cxt.global_obj->GetParallelScanCursor(
+            node->ps.plan->plan_node_id, RelationGetRelid(scan->rs_rd), node->parallelScanNo, dop);
+        if (cursor != NULL) {
+            node->parallelScanRelid = RelationGetRelid(scan->rs_rd);
+        }
+        node->parallelScanNo++;
+        heap_set_parallel_scan_cursor(scan, cursor);
+    }
+
+    scan_handler_tbl_init_parallel_seqscan(scan, dop, node->partScanDirection);
+}
+
+/*
+ * Give back the morsel cursor of the last scan started by this worker, the
+ * cursor is dropped once every worker of the plan node has given it back.
+ */
+static void ReleaseParallelSeqScan(SeqScanState* node)
+{
+    if (!OidIsValid(node->parallelScanRelid)) {
+        return;
+    }
+
+    if (u_sess->stream_cxt.global_obj != NULL) {
+        u_sess->stream_cxt.global_obj->ReleaseParallelScanCursor(
+            node->ps.plan->plan_node_id, node->parallelScanRelid, node->parallelScanNo - 1);
+    }
+    node->parallelScanRelid = InvalidOid;
+}
+
 /*
  * @@GaussDB@@
  * Target		: data partition
@@ -680,6 +680,12 @@ SetOpState* ExecInitSetOp(SetOp* node, EState* estate, int eflags)
         tempfile_para->m_hashAggSource = NULL;
         tempfile_para->maxMem = max_mem * 1024L;
         tempfile_para->spreadNum = 0;
+        tempfile_para->hashshift = 0;
+        tempfile_para->respill = false;
+        tempfile_para->overflowsource = NULL;
+        tempfile_para->overflowfilenum = 0;
+        tempfile_para->overflowshift = 0;
+        tempfile_para->spillTimes = 0;
     }
     setopstate->TempFileControl = tempfile_para;
 
@@ -1410,8 +1410,8 @@ void InsertFusion::InitGlobals()
 
     m_global->m_reloid = getrelid(linitial_int(m_global->m_planstmt->resultRelations), m_global->m_planstmt->rtable);
     ModifyTable* node = (ModifyTable*)m_global->m_planstmt->planTree;
-    BaseResult* baseresult = (BaseResult*)linitial(node->plans);
-    List* targetList = baseresult->plan.targetlist;
+    Plan* subplan = (Plan*)linitial(node->plans);
+    List* targetList = subplan->targetlist;
 
     Relation rel = heap_open(m_global->m_reloid, AccessShareLock);
     m_global->m_natts = RelationGetDescr(rel)->natts;
@@ -1422,12 +1422,36 @@ void InsertFusion::InitGlobals()
 
     /* init param func const */
     m_global->m_paramNum = 0;
-    m_global->m_paramLoc = (ParamLoc*)palloc0(m_global->m_natts * sizeof(ParamLoc));
-    m_c_global->m_targetParamNum = 0;
-    m_c_global->m_targetFuncNum = 0;
-    m_c_global->m_targetFuncNodes = (FuncExprInfo*)palloc0(m_global->m_natts * sizeof(FuncExprInfo));
-    m_c_global->m_targetConstNum = 0;
-    m_c_global->m_targetConstLoc = (ConstLoc*)palloc0(m_global->m_natts * sizeof(ConstLoc));
+    if (IsA(subplan, ValuesScan)) {
+        ValuesScan* values = (ValuesScan*)subplan;
+        m_c_global->m_rowNum = list_length(values->values_lists);
+        m_c_global->m_rows = (InsertFusionRowTarget*)palloc0(m_c_global->m_rowNum * sizeof(InsertFusionRowTarget));
+        ListCell* lc = NULL;
+        int i = 0;
+        foreach (lc, values->values_lists) {
+            InitRowTarget(&m_c_global->m_rows[i++], targetList, (List*)lfirst(lc), values->scan.scanrelid);
+        }
+    } else {
+        m_c_global->m_rowNum = 1;
+        m_c_global->m_rows = (InsertFusionRowTarget*)palloc0(sizeof(InsertFusionRowTarget));
+        InitRowTarget(&m_c_global->m_rows[0], targetList, NIL, 0);
+    }
+    m_global->m_paramLoc = m_c_global->m_rows[0].m_targetParamLoc;
+}
+
+/*
+ * Collect the const/param/func locations of one row to insert. For INSERT ... VALUES
+ * with several rows, the Vars of the ValuesScan targetlist are replaced by the
+ * expressions of the given row of the values list.
+ */
+void InsertFusion::InitRowTarget(InsertFusionRowTarget* row, List* targetList, List* values, Index valuesRelid)
+{
+    row->m_targetParamNum = 0;
+    row->m_targetParamLoc = (ParamLoc*)palloc0(m_global->m_natts * sizeof(ParamLoc));
+    row->m_targetFuncNum = 0;
+    row->m_targetFuncNodes = (FuncExprInfo*)palloc0(m_global->m_natts * sizeof(FuncExprInfo));
+    row->m_targetConstNum = 0;
+    row->m_targetConstLoc = (ConstLoc*)palloc0(m_global->m_natts * sizeof(ConstLoc));
 
     ListCell* lc = NULL;
     int i = 0;
@@ -1438,41 +1462,43 @@ void InsertFusion::InitGlobals()
     foreach (lc, targetList) {
         res = (TargetEntry*)lfirst(lc);
         expr = res->expr;
+        if (values != NIL && IsA(expr, Var) && ((Var*)expr)->varno == valuesRelid) {
+            expr = (Expr*)list_nth(values, ((Var*)expr)->varattno - 1);
+        }
         Assert(
             IsA(expr, Const) || IsA(expr, Param) || IsA(expr, FuncExpr) || IsA(expr, RelabelType) || IsA(expr, OpExpr));
         while (IsA(expr, RelabelType)) {
             expr = ((RelabelType*)expr)->arg;
         }
 
-        m_c_global->m_targetConstLoc[i].constLoc = -1;
+        row->m_targetConstLoc[i].constLoc = -1;
         if (IsA(expr, FuncExpr)) {
             func = (FuncExpr*)expr;
-            m_c_global->m_targetFuncNodes[m_c_global->m_targetFuncNum].resno = res->resno;
-            m_c_global->m_targetFuncNodes[m_c_global->m_targetFuncNum].resname = res->resname;
-            m_c_global->m_targetFuncNodes[m_c_global->m_targetFuncNum].funcid = func->funcid;
-            m_c_global->m_targetFuncNodes[m_c_global->m_targetFuncNum].args = func->args;
-            ++m_c_global->m_targetFuncNum;
+            row->m_targetFuncNodes[row->m_targetFuncNum].resno = res->resno;
+            row->m_targetFuncNodes[row->m_targetFuncNum].resname = res->resname;
+            row->m_targetFuncNodes[row->m_targetFuncNum].funcid = func->funcid;
+            row->m_targetFuncNodes[row->m_targetFuncNum].args = func->args;
+            ++row->m_targetFuncNum;
         } else if (IsA(expr, Param)) {
             Param* param = (Param*)expr;
-            m_global->m_paramLoc[m_c_global->m_targetParamNum].paramId = param->paramid;
-            m_global->m_paramLoc[m_c_global->m_targetParamNum++].scanKeyIndx = i;
+            row->m_targetParamLoc[row->m_targetParamNum].paramId = param->paramid;
+            row->m_targetParamLoc[row->m_targetParamNum++].scanKeyIndx = i;
         } else if (IsA(expr, Const)) {
             Assert(IsA(expr, Const));
-            m_c_global->m_targetConstLoc[i].constValue = ((Const*)expr)->constvalue;
-            m_c_global->m_targetConstLoc[i].constIsNull = ((Const*)expr)->constisnull;
-            m_c_global->m_targetConstLoc[i].constLoc = i;
+            row->m_targetConstLoc[i].constValue = ((Const*)expr)->constvalue;
+            row->m_targetConstLoc[i].constIsNull = ((Const*)expr)->constisnull;
+            row->m_targetConstLoc[i].constLoc = i;
         } else if (IsA(expr, OpExpr)) {
             opexpr = (OpExpr*)expr;
-            m_c_global->m_targetFuncNodes[m_c_global->m_targetFuncNum].resno = res->resno;
-            m_c_global->m_targetFuncNodes[m_c_global->m_targetFuncNum].resname = res->resname;
-            m_c_global->m_targetFuncNodes[m_c_global->m_targetFuncNum].funcid = opexpr->opfuncid;
-            m_c_global->m_targetFuncNodes[m_c_global->m_targetFuncNum].args = opexpr->args;
-            ++m_c_global->m_targetFuncNum;
+            row->m_targetFuncNodes[row->m_targetFuncNum].resno = res->resno;
+            row->m_targetFuncNodes[row->m_targetFuncNum].resname = res->resname;
+            row->m_targetFuncNodes[row->m_targetFuncNum].funcid = opexpr->opfuncid;
+            row->m_targetFuncNodes[row->m_targetFuncNum].args = opexpr->args;
+            ++row->m_targetFuncNum;
         }
         i++;
     }
-    m_c_global->m_targetConstNum = i;
-
+    row->m_targetConstNum = i;
 }
 void InsertFusion::InitLocals(ParamListInfo params)
 {
@@ -1505,7 +1531,7 @@ InsertFusion::InsertFusion(MemoryContext context, CachedPlanSource* psrc, List*
     MemoryContextSwitchTo(old_context);
 }
 
-void InsertFusion::refreshParameterIfNecessary()
+void InsertFusion::refreshParameterIfNecessary(const InsertFusionRowTarget* row)
 {
     ParamListInfo parms = m_local.m_outParams != NULL ? m_local.m_outParams : m_local.m_params;
     bool func_isnull = false;
@@ -1515,34 +1541,34 @@ void InsertFusion::refreshParameterIfNecessary()
         m_c_local.m_curVarIsnull[i] = m_local.m_isnull[i];
     }
     /* refresh const value */
-    for (int i = 0; i < m_c_global->m_targetConstNum; i++) {
-        if (m_c_global->m_targetConstLoc[i].constLoc >= 0) {
-            m_local.m_values[m_c_global->m_targetConstLoc[i].constLoc] = m_c_global->m_targetConstLoc[i].constValue;
-            m_local.m_isnull[m_c_global->m_targetConstLoc[i].constLoc] = m_c_global->m_targetConstLoc[i].constIsNull;
+    for (int i = 0; i < row->m_targetConstNum; i++) {
+        if (row->m_targetConstLoc[i].constLoc >= 0) {
+            m_local.m_values[row->m_targetConstLoc[i].constLoc] = row->m_targetConstLoc[i].constValue;
+            m_local.m_isnull[row->m_targetConstLoc[i].constLoc] = row->m_targetConstLoc[i].constIsNull;
         }
     }
     /* calculate func result */
-    for (int i = 0; i < m_c_global->m_targetFuncNum; ++i) {
-        ELOG_FIELD_NAME_START(m_c_global->m_targetFuncNodes[i].resname);
-        if (m_c_global->m_targetFuncNodes[i].funcid != InvalidOid) {
+    for (int i = 0; i < row->m_targetFuncNum; ++i) {
+        ELOG_FIELD_NAME_START(row->m_targetFuncNodes[i].resname);
+        if (row->m_targetFuncNodes[i].funcid != InvalidOid) {
             func_isnull = false;
-            m_local.m_values[m_c_global->m_targetFuncNodes[i].resno - 1] =
-                CalFuncNodeVal(m_c_global->m_targetFuncNodes[i].funcid,
-                               m_c_global->m_targetFuncNodes[i].args,
+            m_local.m_values[row->m_targetFuncNodes[i].resno - 1] =
+                CalFuncNodeVal(row->m_targetFuncNodes[i].funcid,
+                               row->m_targetFuncNodes[i].args,
                                &func_isnull,
                                m_c_local.m_curVarValue,
                                m_c_local.m_curVarIsnull);
-            m_local.m_isnull[m_c_global->m_targetFuncNodes[i].resno - 1] = func_isnull;
+            m_local.m_isnull[row->m_targetFuncNodes[i].resno - 1] = func_isnull;
         }
         ELOG_FIELD_NAME_END;
     }
     /* mapping params */
-    if (m_c_global->m_targetParamNum > 0) {
-        for (int i = 0; i < m_c_global->m_targetParamNum; i++) {
-            m_local.m_values[m_global->m_paramLoc[i].scanKeyIndx] =
-                parms->params[m_global->m_paramLoc[i].paramId - 1].value;
-            m_local.m_isnull[m_global->m_paramLoc[i].scanKeyIndx] =
-                parms->params[m_global->m_paramLoc[i].paramId - 1].isnull;
+    if (row->m_targetParamNum > 0) {
+        for (int i = 0; i < row->m_targetParamNum; i++) {
+            m_local.m_values[row->m_targetParamLoc[i].scanKeyIndx] =
+                parms->params[row->m_targetParamLoc[i].paramId - 1].value;
+            m_local.m_isnull[row->m_targetParamLoc[i].scanKeyIndx] =
+                parms->params[row->m_targetParamLoc[i].paramId - 1].isnull;
         }
     }
 }
@@ -1570,9 +1596,13 @@ bool InsertFusion::execute(long max_rows, char* completionTag)
         ExecOpenIndices(result_rel_info, false);
     }
 
+    if (m_c_global->m_rowNum > 1) {
+        return executeMultiRows(rel, result_rel_info, completionTag);
+    }
+
     CommandId mycid = GetCurrentCommandId(true);
 
-    refreshParameterIfNecessary();
+    refreshParameterIfNecessary(&m_c_global->m_rows[0]);
     init_gtt_storage(CMD_INSERT, result_rel_info);
     /************************
      * step 2: begin insert *
@@ -1658,6 +1688,90 @@ bool InsertFusion::execute(long max_rows, char* completionTag)
     return success;
 }
 
+/*
+ * Insert all rows of INSERT ... VALUES (...), (...) at once. The tuples go into the
+ * heap through a single tableam_tuple_multi_insert call, which fills the target page
+ * as far as possible and WAL-logs each page once instead of each tuple, then the
+ * index entries of all tuples are inserted. Only plain heap relations get here, see
+ * getInsertFusionType.
+ */
+bool InsertFusion::executeMultiRows(Relation rel, ResultRelInfo* result_rel_info, char* completionTag)
+{
+    int row_num = m_c_global->m_rowNum;
+    HeapTuple* tuples = (HeapTuple*)palloc(row_num * sizeof(HeapTuple));
+    CommandId mycid = GetCurrentCommandId(true);
+
+    init_gtt_storage(CMD_INSERT, result_rel_info);
+    /************************
+     * step 2: begin insert *
+     ************************/
+    for (int i = 0; i < row_num; i++) {
+        refreshParameterIfNecessary(&m_c_global->m_rows[i]);
+        HeapTuple tuple = (HeapTuple)tableam_tops_form_tuple(m_global->m_tupDesc, m_local.m_values,
+                                                             m_local.m_isnull, HEAP_TUPLE);
+        Assert(tuple != NULL);
+        (void)ExecStoreTuple(tuple, m_local.m_reslot, InvalidBuffer, false);
+
+        /*
+         * Compute stored generated columns
+         */
+        if (rel->rd_att->constr && rel->rd_att->constr->has_generated_stored) {
+            ExecComputeStoredGenerated(result_rel_info, m_c_local.m_estate, m_local.m_reslot, tuple, CMD_INSERT);
+            if (tuple != (HeapTuple)m_local.m_reslot->tts_tuple) {
+                tableam_tops_free_tuple(tuple);
+                /* the slot owns the new tuple, keep our own copy until the batch is inserted */
+                tuple = (HeapTuple)tableam_tops_copy_tuple(m_local.m_reslot->tts_tuple);
+            }
+        }
+
+        if (rel->rd_att->constr) {
+            ExecConstraints(result_rel_info, m_local.m_reslot, m_c_local.m_estate);
+        }
+        (void)ExecClearTuple(m_local.m_reslot);
+        tuples[i] = tuple;
+    }
+
+    /*
+     * No page compression. Page replication must stay off: it skips WAL and relies on
+     * the relation being synced at commit, which only COPY and ModifyTable arrange.
+     */
+    HeapMultiInsertExtraArgs args = {NULL, 0, true};
+    (void)tableam_tuple_multi_insert(rel, rel, (Tuple*)tuples, row_num, mycid, 0, NULL, &args);
+
+    /* insert index entries for the tuples */
+    for (int i = 0; i < row_num; i++) {
+        if (rel->rd_mlogoid != InvalidOid) {
+            insert_into_mlog_table(rel, rel->rd_mlogoid, tuples[i], &tuples[i]->t_self,
+                                   GetCurrentTransactionId(), 'I');
+        }
+        if (result_rel_info->ri_NumIndices > 0) {
+            (void)ExecStoreTuple(tuples[i], m_local.m_reslot, InvalidBuffer, false);
+            List* recheck_indexes = ExecInsertIndexTuples(m_local.m_reslot, &(tuples[i]->t_self),
+                                                          m_c_local.m_estate, NULL, NULL, InvalidBktId, NULL);
+            list_free_ext(recheck_indexes);
+            (void)ExecClearTuple(m_local.m_reslot);
+        }
+        tableam_tops_free_tuple(tuples[i]);
+    }
+    pfree_ext(tuples);
+
+    m_local.m_isCompleted = true;
+    /****************
+     * step 3: done *
+     ****************/
+    ExecCloseIndices(result_rel_info);
+
+    heap_close(rel, RowExclusiveLock);
+
+    ExecDoneStepInFusion(NULL, m_c_local.m_estate);
+
+    errno_t errorno = snprintf_s(completionTag, COMPLETION_TAG_BUFSIZE, COMPLETION_TAG_BUFSIZE - 1,
+                                 "INSERT 0 %d", row_num);
+    securec_check_ss(errorno, "\0", "\0");
+
+    return true;
+}
+
 #ifdef ENABLE_MOT
 MotJitModifyFusion::MotJitModifyFusion(
     MemoryContext context, CachedPlanSource* psrc, List* plantree_list, ParamListInfo params)
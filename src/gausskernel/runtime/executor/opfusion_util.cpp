@@ -34,6 +34,7 @@
 #include "mb/pg_wchar.h"
 #include "nodes/makefuncs.h"
 #include "optimizer/clauses.h"
+#include "optimizer/var.h"
 #include "parser/parsetree.h"
 #include "utils/dynahash.h"
 #include "utils/lsyscache.h"
@@ -858,16 +859,60 @@ void checkTargetlist(List *targetList, FusionType* ftype)
     }
     return;
 }
+/*
+ * check multi-row INSERT ... VALUES, every row must be as simple as the
+ * targetlist of a single-row insert, so it can be computed without a planstate.
+ */
+static FusionType checkValuesScan(ValuesScan *node)
+{
+    if (node->scan.plan.lefttree != NULL || node->scan.plan.initPlan != NIL || node->scan.plan.qual != NIL) {
+        return NOBYPASS_NO_SIMPLE_INSERT;
+    }
+    if (list_length(node->values_lists) > MAX_FUSION_INSERT_ROWS) {
+        return NOBYPASS_NO_SIMPLE_INSERT;
+    }
+
+    ListCell *lc = NULL;
+    foreach (lc, node->scan.plan.targetlist) {
+        Expr *expr = ((TargetEntry *)lfirst(lc))->expr;
+        if (IsA(expr, Var) && ((Var *)expr)->varno == node->scan.scanrelid) {
+            continue;
+        }
+        /* default values added by the rewriter must not refer to the values list */
+        if (contain_var_clause((Node *)expr)) {
+            return NOBYPASS_NO_SIMPLE_INSERT;
+        }
+    }
+
+    ListCell *row = NULL;
+    foreach (row, node->values_lists) {
+        foreach (lc, (List *)lfirst(row)) {
+            Node *expr = (Node *)lfirst(lc);
+            if (contain_var_clause(expr) || !checkExpr(expr, true)) {
+                return NOBYPASS_EXP_NOT_SUPPORT;
+            }
+        }
+    }
+    return BYPASS_OK;
+}
+
 FusionType checkBaseResult(Plan* top_plan)
 {
     FusionType result = INSERT_FUSION;
     ModifyTable *node = (ModifyTable *)top_plan;
-    if (!IsA(linitial(node->plans), BaseResult)) {
-        return NOBYPASS_NO_SIMPLE_INSERT;
-    }
-    BaseResult *base = (BaseResult *)linitial(node->plans);
-    if (base->plan.lefttree != NULL || base->plan.initPlan != NIL || base->resconstantqual != NULL) {
+    Plan *subplan = (Plan *)linitial(node->plans);
+    if (IsA(subplan, ValuesScan)) {
+        FusionType ttype = checkValuesScan((ValuesScan *)subplan);
+        if (ttype > BYPASS_OK) {
+            return ttype;
+        }
+    } else if (!IsA(subplan, BaseResult)) {
         return NOBYPASS_NO_SIMPLE_INSERT;
+    } else {
+        BaseResult *base = (BaseResult *)subplan;
+        if (base->plan.lefttree != NULL || base->plan.initPlan != NIL || base->resconstantqual != NULL) {
+            return NOBYPASS_NO_SIMPLE_INSERT;
+        }
     }
     if (node->upsertAction != UPSERT_NONE) {
         return NOBYPASS_UPSERT_NOT_SUPPORT;
@@ -902,7 +947,7 @@ FusionType getInsertFusionType(List *stmt_list, ParamListInfo params)
         return ttype;
     }
     ModifyTable *node = (ModifyTable *)top_plan;
-    BaseResult *base = (BaseResult *)linitial(node->plans);
+    Plan *subplan = (Plan *)linitial(node->plans);
 
     /* check relation */
     Index res_rel_idx = linitial_int(plannedstmt->resultRelations);
@@ -939,12 +984,18 @@ FusionType getInsertFusionType(List *stmt_list, ParamListInfo params)
         heap_close(rel, AccessShareLock);
         return NOBYPASS_PARTITION_NOT_SUPPORT_IN_LIST_OR_HASH_PARTITION;
     }
+    /* multi-row insert goes through heap_multi_insert, which knows nothing about partitions and buckets */
+    if (IsA(subplan, ValuesScan) &&
+        (RELATION_IS_PARTITIONED(rel) || RELATION_OWN_BUCKET(rel) || rel->rd_tam_type != TAM_HEAP)) {
+        heap_close(rel, AccessShareLock);
+        return NOBYPASS_DML_RELATION_NOT_SUPPORT;
+    }
     heap_close(rel, AccessShareLock);
     /*
      * check targetlist
      * maybe expr type is FuncExpr because of type conversion.
      */
-    List *targetlist = base->plan.targetlist;
+    List *targetlist = subplan->targetlist;
     checkTargetlist(targetlist, &ftype);
     return ftype;
 }
@@ -33,6 +33,7 @@
 #include "executor/nodeSort.h"
 #include "executor/nodeStub.h"
 #include "miscadmin.h"
+#include "pgstat.h"
 #include "nodes/execnodes.h"
 #include "nodes/plannodes.h"
 #include "vecexecutor/vectorbatch.h"
@@ -147,6 +148,7 @@ VectorBatch* VectorEngine(PlanState* node)
 {
     VectorBatch* result = NULL;
     MemoryContext old_context;
+    int oldPlanNodeId = -1;
 
     CHECK_FOR_INTERRUPTS();
 
@@ -168,10 +170,16 @@ VectorBatch* VectorEngine(PlanState* node)
     if (node->instrument)
         InstrStartNode(node->instrument);
 
+    if (u_sess->attr.attr_common.enable_asp)
+        oldPlanNodeId = pgstat_report_exec_plannode(node->plan->plan_node_id);
+
     t_thrd.pgxc_cxt.GlobalNetInstr = node->instrument;
     result = VectorEngineRunner[GetRunnerIdx(nodeTag(node))](node);
     t_thrd.pgxc_cxt.GlobalNetInstr = NULL;
 
+    if (u_sess->attr.attr_common.enable_asp)
+        (void)pgstat_report_exec_plannode(oldPlanNodeId);
+
     if (node->instrument) {
         switch (nodeTag(node)) {
             case T_VecModifyTableState:
@@ -509,7 +509,9 @@ VecNestLoopState* ExecInitVecNestLoop(VecNestLoop* node, EState* estate, int efl
         eflags |= EXEC_FLAG_REWIND;
     else
         eflags &= ~EXEC_FLAG_REWIND;
+    estate->es_under_rescan_inner++;
     innerPlanState(nlstate) = ExecInitNode(innerPlan(node), estate, eflags);
+    estate->es_under_rescan_inner--;
 
     /*
      * tuple table initialization
@@ -627,6 +627,28 @@ void VectorBatch::CopyNth(VectorBatch* batch, int nth)
     m_rows++;
 }
 
+/*
+ * @Description: Append the given rows of batch, column by column.
+ *
+ * @param[IN] batch: source batch
+ * @param[IN] rows: row numbers in the source batch
+ * @param[IN] nrows: number of rows, must fit into this batch
+ */
+void VectorBatch::CopyNthRows(VectorBatch* batch, const int* rows, int nrows)
+{
+    Assert(m_rows + nrows <= BatchMaxSize);
+
+    for (int i = 0; i < m_cols; i++) {
+        ScalarVector* dst = &m_arr[i];
+        ScalarVector* src = &batch->m_arr[i];
+        for (int j = 0; j < nrows; j++) {
+            dst->copyNth(src, rows[j]);
+        }
+    }
+
+    m_rows += nrows;
+}
+
 Datum ScalarVector::AddVar(Datum data, int aindex)
 {
     return (this->*m_addVar)(data, aindex);
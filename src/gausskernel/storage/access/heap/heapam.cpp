@@ -75,6 +75,7 @@
 #include "storage/procarray.h"
 #include "storage/smgr.h"
 #include "storage/standby.h"
+#include "utils/atomic.h"
 #include "utils/datum.h"
 #include "utils/inval.h"
 #include "utils/lsyscache.h"
@@ -241,6 +242,8 @@ static void initscan(HeapScanDesc scan, ScanKey key, bool is_rescan)
     scan->rs_base.rs_cblock = InvalidBlockNumber;
     scan->rs_base.rs_ss_accessor = NULL;
     scan->dop = 1;
+    scan->rs_morsel_cursor = NULL;
+    scan->rs_morsel_end = InvalidBlockNumber;
 
     /* we don't have a marked position... */
     ItemPointerSetInvalid(&(scan->rs_mctid));
@@ -400,6 +403,25 @@ void heap_prefetch(HeapScanDesc scan, ScanDirection dir)
     ADIO_END();
 }
 
+/*
+ * @Description: Claim the next morsel from the shared cursor of a parallel scan.
+ *
+ * @param[IN] scan: heap scan describtion.
+ * @return BlockNumber: first block of the claimed morsel.
+ */
+static inline BlockNumber claim_scan_morsel(HeapScanDesc scan)
+{
+    uint32 morsel = pg_atomic_fetch_add_u32(scan->rs_morsel_cursor, 1);
+    uint64 start = (uint64)morsel * PARALLEL_SCAN_MORSEL;
+
+    if (start >= scan->rs_base.rs_nblocks) {
+        scan->rs_morsel_end = scan->rs_base.rs_nblocks;
+        return scan->rs_base.rs_nblocks;
+    }
+    scan->rs_morsel_end = (BlockNumber)Min(start + PARALLEL_SCAN_MORSEL, scan->rs_base.rs_nblocks);
+    return (BlockNumber)start;
+}
+
 /*
  * @Description: Calculate the next page number.
  *
@@ -412,7 +434,15 @@ FORCE_INLINE
 bool next_page(HeapScanDesc scan, ScanDirection dir, BlockNumber &page)
 {
     bool finished = false;
-    if (scan->dop > 1) {
+    if (scan->rs_morsel_cursor != NULL) {
+        /* Morsel driven parallel scan, only set up for forward scans. */
+        Assert(ScanDirectionIsForward(dir));
+        page++;
+        if (page >= scan->rs_morsel_end) {
+            page = claim_scan_morsel(scan);
+        }
+        finished = (page >= scan->rs_base.rs_nblocks);
+    } else if (scan->dop > 1) {
         if (BackwardScanDirection == dir) {
             finished = (page == 0);
             if (finished)
@@ -7787,20 +7817,54 @@ void PushHeapPageToDataQueue(Buffer buffer)
     }
 }
 
+/*
+ * @Description: Make a parallel scan pull its blocks from a cursor shared by all
+ * smp workers, must be called before heap_init_parallel_seqscan.
+ *
+ * @param[IN] sscan: heap scan describtion.
+ * @param[IN] cursor: shared morsel cursor, NULL for the static block split.
+ */
+void heap_set_parallel_scan_cursor(TableScanDesc sscan, volatile uint32* cursor)
+{
+    HeapScanDesc scan = (HeapScanDesc) sscan;
+
+    if (scan != NULL) {
+        scan->rs_morsel_cursor = cursor;
+    }
+}
+
 void heap_init_parallel_seqscan(TableScanDesc sscan, int32 dop, ScanDirection dir)
 {
     HeapScanDesc scan = (HeapScanDesc) sscan;
 
-    if (!scan || scan->rs_base.rs_nblocks == 0) {
+    if (!scan) {
         return;
     }
 
-    if (dop <= 1) {
+    volatile uint32* cursor = scan->rs_morsel_cursor;
+    scan->rs_morsel_cursor = NULL;
+
+    if (scan->rs_base.rs_nblocks == 0 || dop <= 1) {
         return;
     }
 
     scan->dop = dop;
 
+    /*
+     * With a shared cursor workers pull small block ranges on demand instead of
+     * taking every dop'th range, so a slow worker does not leave the others idle
+     * at the end of the scan.
+     */
+    if (cursor != NULL && ScanDirectionIsForward(dir) && !scan->rs_base.rs_rangeScanInRedis.isRangeScanInRedis) {
+        scan->rs_morsel_cursor = cursor;
+        scan->rs_base.rs_startblock = claim_scan_morsel(scan);
+        if (scan->rs_base.rs_startblock >= scan->rs_base.rs_nblocks) {
+            scan->rs_base.rs_startblock = 0;
+            scan->rs_base.rs_nblocks = 0;
+        }
+        return;
+    }
+
     uint32 paral_blocks = u_sess->stream_cxt.smp_id * PARALLEL_SCAN_GAP;
 
     /* If not enough pages to divide into every worker. */
@@ -42,6 +42,7 @@
 
 #include "catalog/storage_xlog.h"
 #include "storage/buf/buf_internals.h"
+#include "storage/buf/bufmgr.h"
 #include "storage/ipc.h"
 #include "storage/standby.h"
 #include "utils/hsearch.h"
@@ -407,9 +408,10 @@ void DumpDispatcher()
     state = g_instance.comm_cxt.predo_cxt.state;
     if ((get_real_recovery_parallelism() > 1) && (GetBatchCount() > 0)) {
         ereport(LOG, (errmodule(MOD_REDO), errcode(ERRCODE_LOG),
-                      errmsg("[REDO_LOG_TRACE]dispatcher : totalWorkerCount %d, state %u, curItemNum %u, maxItemNum %u",
+                      errmsg("[REDO_LOG_TRACE]dispatcher : totalWorkerCount %d, state %u, curItemNum %u, "
+                             "maxItemNum %u, prefetchBlockCount %lu",
                              get_real_recovery_parallelism(), (uint32)state, g_dispatcher->curItemNum,
-                             g_dispatcher->maxItemNum)));
+                             g_dispatcher->maxItemNum, g_dispatcher->prefetchBlockCount)));
 
         for (uint32 i = 0; i < g_dispatcher->pageLineNum; ++i) {
             pl = &(g_dispatcher->pageLines[i]);
@@ -449,6 +451,8 @@ static LogDispatcher *CreateDispatcher()
     newDispatcher->needFullSyncCheckpoint = false;
     newDispatcher->smartShutdown = false;
     newDispatcher->recoveryStop = false;
+    newDispatcher->prefetchReln = NULL;
+    newDispatcher->prefetchBlockCount = 0;
     return newDispatcher;
 }
 
@@ -587,6 +591,9 @@ static void DestroyRecoveryWorkers()
 {
     if (g_dispatcher != NULL) {
         SpinLockAcquire(&(g_instance.comm_cxt.predo_cxt.destroy_lock));
+        if (g_dispatcher->prefetchReln != NULL) {
+            smgrclose(g_dispatcher->prefetchReln);
+        }
         for (uint32 i = 0; i < g_dispatcher->pageLineNum; i++) {
             DestroyPageRedoWorker(g_dispatcher->pageLines[i].batchThd);
             DestroyPageRedoWorker(g_dispatcher->pageLines[i].managerThd);
@@ -923,10 +930,71 @@ static void DispatchRecordWithoutPage(XLogReaderState *record, List *expectedTLI
     DereferenceRedoItem(item);
 }
 
+/*
+ * Run from the dispatcher thread.
+ *
+ * Issue asynchronous reads for the blocks referenced by the record that are not in
+ * shared buffers yet, so that the page redo workers find them in the OS cache. The
+ * record is replayed only after it travels through the batch, manager and redo
+ * worker queues, so the depth of these queues is the look-ahead distance. Blocks
+ * that are restored from a full-page image or re-initialized by redo are never read
+ * and are skipped.
+ */
+static void PrefetchRecordBlocks(XLogReaderState *record)
+{
+#if defined(USE_PREFETCH) && defined(USE_POSIX_FADVISE)
+    if (u_sess->storage_cxt.target_prefetch_pages <= 0) {
+        return;
+    }
+
+    for (int blockId = 0; blockId <= record->max_block_id; blockId++) {
+        RelFileNode rnode;
+        ForkNumber forknum;
+        BlockNumber blkno;
+
+        if (!XLogRecGetBlockTag(record, blockId, &rnode, &forknum, &blkno)) {
+            continue;
+        }
+        if (XLogRecHasBlockImage(record, blockId) || (record->blocks[blockId].flags & BKPBLOCK_WILL_INIT) ||
+            rnode.bucketNode == DIR_BUCKET_ID) {
+            continue;
+        }
+
+        BufferTag tag;
+        INIT_BUFFERTAG(tag, rnode, forknum, blkno);
+        uint32 hash = BufTableHashCode(&tag);
+        LWLock *partitionLock = BufMappingPartitionLock(hash);
+
+        (void)LWLockAcquire(partitionLock, LW_SHARED);
+        int bufId = BufTableLookup(&tag, hash);
+        LWLockRelease(partitionLock);
+        if (bufId >= 0) {
+            continue;
+        }
+
+        /*
+         * Keep at most one relation open for prefetching, so the dispatcher does not
+         * hold file descriptors of relations that are dropped later in the log.
+         */
+        SMgrRelation reln = g_dispatcher->prefetchReln;
+        if (reln == NULL || !RelFileNodeEquals(reln->smgr_rnode.node, rnode)) {
+            if (reln != NULL) {
+                smgrclose(reln);
+            }
+            reln = smgropen(rnode, InvalidBackendId);
+            smgrsetowner(&g_dispatcher->prefetchReln, reln);
+        }
+        smgrprefetch(reln, forknum, blkno);
+        g_dispatcher->prefetchBlockCount++;
+    }
+#endif
+}
+
 /* Run from the dispatcher thread. */
 static void DispatchRecordWithPages(XLogReaderState *record, List *expectedTLIs, bool rnodedispatch)
 {
     GetSlotIds(record, ANY_WORKER, rnodedispatch);
+    PrefetchRecordBlocks(record);
 
     RedoItem *item = GetRedoItemPtr(record);
     ReferenceRedoItem(item);
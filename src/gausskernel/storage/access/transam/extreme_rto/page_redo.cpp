@@ -1142,6 +1142,98 @@ void RedoPageWorkerRedoBcmBlock(XLogRecParseState *procState)
     }
 }
 
+/*
+ * Upper bound of queue entries applied under one buffer lock, so a hot page does not
+ * starve hot standby readers waiting for the buffer.
+ */
+static const uint32 MAX_COALESCED_REDO_ENTRIES = 64;
+
+static inline bool IsSameRedoBlock(const XLogBlockHead *left, const XLogBlockHead *right)
+{
+    return left->blkno == right->blkno && left->relNode == right->relNode && left->forknum == right->forknum &&
+           left->dbNode == right->dbNode && left->spcNode == right->spcNode && left->bucketNode == right->bucketNode;
+}
+
+/*
+ * The page manager already links the records of one block that arrive in the same batch,
+ * but a hot page modified by many consecutive records still shows up as many short chains
+ * in a row. If the entry queued right after the current one is a chain for the block that
+ * is still pinned and locked, return it so that it is applied without releasing and
+ * re-reading the buffer. The current entry stays in the queue until the caller pops it, so
+ * managers waiting for an empty queue still wait for the buffer to be flushed.
+ */
+static XLogRecParseState *GetNextSameBlockRedoEntry(const XLogRecParseState *current,
+                                                    const RedoBufferInfo *bufferinfo, uint32 coalescedNum)
+{
+    if (bufferinfo->pageinfo.page == NULL || current->isFullSyncCheckpoint ||
+        coalescedNum >= MAX_COALESCED_REDO_ENTRIES) {
+        return NULL;
+    }
+
+    void *next = SPSCBlockingQueuePeek(g_redoWorker->queue, 1);
+    if (next == NULL || next == (void *)&g_redoEndMark || next == (void *)&g_cleanupMark ||
+        next == (void *)&g_GlobalLsnForwarder) {
+        return NULL;
+    }
+
+    XLogRecParseState *nextState = (XLogRecParseState *)next;
+    /* an entry carrying a full sync checkpoint is applied and flushed in a round of its own */
+    if (nextState->isFullSyncCheckpoint) {
+        return NULL;
+    }
+    const XLogBlockHead *nextHead = &nextState->blockparse.blockhead;
+    uint16 blockValid = XLogBlockHeadGetValidInfo(nextHead);
+    if (blockValid != BLOCK_DATA_MAIN_DATA_TYPE && blockValid != BLOCK_DATA_VM_TYPE &&
+        blockValid != BLOCK_DATA_FSM_TYPE) {
+        return NULL;
+    }
+    if (XLogBlockHeadGetValidInfo(&current->blockparse.blockhead) != blockValid ||
+        !IsSameRedoBlock(&current->blockparse.blockhead, nextHead)) {
+        return NULL;
+    }
+    return nextState;
+}
+
+/* Apply a chain of parse states of one block, the buffer stays locked in bufferinfo. */
+static bool RedoPageWorkerApplyChain(XLogRecParseState *procState, RedoBufferInfo *bufferinfo, bool notfound)
+{
+    MemoryContext oldCtx = MemoryContextSwitchTo(g_redoWorker->oldCtx);
+    while (procState != NULL) {
+        XLogRecParseState *redoblockstate = procState;
+        procState = (XLogRecParseState *)procState->nextrecord;
+
+        switch (XLogBlockHeadGetValidInfo(&redoblockstate->blockparse.blockhead)) {
+            case BLOCK_DATA_MAIN_DATA_TYPE:
+            case BLOCK_DATA_VM_TYPE:
+            case BLOCK_DATA_FSM_TYPE:
+                notfound = XLogBlockRedoForExtremeRTO(redoblockstate, bufferinfo, notfound);
+                break;
+            case BLOCK_DATA_XLOG_COMMON_TYPE:
+                RedoPageWorkerCheckPoint(redoblockstate);
+                SetCompletedReadEndPtr(g_redoWorker, redoblockstate->blockparse.blockhead.start_ptr,
+                                       redoblockstate->blockparse.blockhead.end_ptr);
+                break;
+            case BLOCK_DATA_DDL_TYPE:
+                XLogForgetDDLRedo(redoblockstate);
+                SetCompletedReadEndPtr(g_redoWorker, redoblockstate->blockparse.blockhead.start_ptr,
+                                       redoblockstate->blockparse.blockhead.end_ptr);
+                break;
+            case BLOCK_DATA_DROP_DATABASE_TYPE:
+                XLogDropDatabase(redoblockstate->blockparse.blockhead.dbNode);
+                SetCompletedReadEndPtr(g_redoWorker, redoblockstate->blockparse.blockhead.start_ptr,
+                                       redoblockstate->blockparse.blockhead.end_ptr);
+                break;
+            case BLOCK_DATA_NEWCU_TYPE:
+                RedoPageWorkerRedoBcmBlock(redoblockstate);
+                break;
+            default:
+                break;
+        }
+    }
+    (void)MemoryContextSwitchTo(oldCtx);
+    return notfound;
+}
+
 void RedoPageWorkerMain()
 {
     (void)RegisterRedoInterruptCallBack(HandlePageRedoInterrupts);
@@ -1168,50 +1260,24 @@ void RedoPageWorkerMain()
         RedoBufferInfo bufferinfo = {0};
         bool notfound = false;
         bool updateFsm = false;
+        uint32 coalescedNum = 0;
 
-        XLogRecParseState *procState = redoblockstateHead;
-
-        MemoryContext oldCtx = MemoryContextSwitchTo(g_redoWorker->oldCtx);
-        while (procState != NULL) {
-            XLogRecParseState *redoblockstate = procState;
-            procState = (XLogRecParseState *)procState->nextrecord;
-
-            switch (XLogBlockHeadGetValidInfo(&redoblockstate->blockparse.blockhead)) {
-                case BLOCK_DATA_MAIN_DATA_TYPE:
-                case BLOCK_DATA_VM_TYPE:
-                case BLOCK_DATA_FSM_TYPE:
-                    notfound = XLogBlockRedoForExtremeRTO(redoblockstate, &bufferinfo, notfound);
-                    break;
-                case BLOCK_DATA_XLOG_COMMON_TYPE:
-                    RedoPageWorkerCheckPoint(redoblockstate);
-                    SetCompletedReadEndPtr(g_redoWorker, redoblockstate->blockparse.blockhead.start_ptr,
-                                           redoblockstate->blockparse.blockhead.end_ptr);
-                    break;
-                case BLOCK_DATA_DDL_TYPE:
-                    XLogForgetDDLRedo(redoblockstate);
-                    SetCompletedReadEndPtr(g_redoWorker, redoblockstate->blockparse.blockhead.start_ptr,
-                                           redoblockstate->blockparse.blockhead.end_ptr);
-                    break;
-                case BLOCK_DATA_DROP_DATABASE_TYPE:
-                    XLogDropDatabase(redoblockstate->blockparse.blockhead.dbNode);
-                    SetCompletedReadEndPtr(g_redoWorker, redoblockstate->blockparse.blockhead.start_ptr,
-                                           redoblockstate->blockparse.blockhead.end_ptr);
-                    break;
-                case BLOCK_DATA_NEWCU_TYPE:
-                    RedoPageWorkerRedoBcmBlock(redoblockstate);
-                    break;
-                default:
-                    break;
+        for (;;) {
+            notfound = RedoPageWorkerApplyChain(redoblockstateHead, &bufferinfo, notfound);
+            updateFsm = XlogNeedUpdateFsm(redoblockstateHead, &bufferinfo) || updateFsm;
+            if (redoblockstateHead->isFullSyncCheckpoint) {
+                pg_atomic_write_u32(&g_redoWorker->fullSyncFlag, 1);
             }
+            XLogRecParseState *nextHead = GetNextSameBlockRedoEntry(redoblockstateHead, &bufferinfo, coalescedNum);
+            XLogBlockParseStateRelease(redoblockstateHead);
+            if (nextHead == NULL) {
+                break;
+            }
+            /* keep the buffer locked and go on with the next entry of the same page */
+            SPSCBlockingQueuePop(g_redoWorker->queue);
+            redoblockstateHead = nextHead;
+            coalescedNum++;
         }
-        (void)MemoryContextSwitchTo(oldCtx);
-
-        updateFsm = XlogNeedUpdateFsm(redoblockstateHead, &bufferinfo);
-        bool needWait = redoblockstateHead->isFullSyncCheckpoint;
-        if (needWait) {
-            pg_atomic_write_u32(&g_redoWorker->fullSyncFlag, 1);
-        }
-        XLogBlockParseStateRelease(redoblockstateHead);
         /* the same page */
         ExtremeRtoFlushBuffer(&bufferinfo, updateFsm);
         SPSCBlockingQueuePop(g_redoWorker->queue);
@@ -1596,6 +1662,23 @@ void CheckToForcePushLsn(const XLogRecord *record)
     }
 }
 
+/*
+ * Decode the record in the read page worker, right after it was assembled and CRC
+ * checked, so that the startup thread only has to dispatch it. Decoding and dispatch
+ * then run in a pipeline on two threads and the queue between them keeps LSN order.
+ * On failure the record is left undecoded, the startup thread decodes it again and
+ * reports the error as before.
+ */
+static inline void DecodeRecordInReadWorker(XLogReaderState *xlogreader)
+{
+    char *errormsg = NULL;
+
+    if (xlogreader->isDecode) {
+        return;
+    }
+    (void)DecodeXLogRecord(xlogreader, (XLogRecord *)xlogreader->readRecordBuf, &errormsg, false);
+}
+
 /* read xlog for parellel */
 void XLogReadPageWorkerMain()
 {
@@ -1623,6 +1706,7 @@ void XLogReadPageWorkerMain()
             break;
         }
         newxlogreader = NewReaderState(xlogreader);
+        DecodeRecordInReadWorker(xlogreader);
         PutRecordToReadQueue(xlogreader);
         xlogreader = newxlogreader;
 
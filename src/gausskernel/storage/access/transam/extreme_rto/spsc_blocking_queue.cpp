@@ -260,6 +260,18 @@ void *SPSCBlockingQueueTop(SPSCBlockingQueue *queue)
     return elem;
 }
 
+/* Return the n-th element after the top one without waiting, or NULL if the queue is not that long. */
+void *SPSCBlockingQueuePeek(SPSCBlockingQueue *queue, uint32 n)
+{
+    uint32 tail = pg_atomic_read_u32(&queue->readTail);
+    uint32 head = pg_atomic_read_u32(&queue->writeHead);
+    if (COUNT(head, tail, queue->mask) <= n) {
+        return NULL;
+    }
+    pg_read_barrier();
+    return queue->buffer[(tail + n) & queue->mask];
+}
+
 void SPSCBlockingQueuePop(SPSCBlockingQueue *queue)
 {
     uint32 head;
@@ -48,6 +48,7 @@
 #include "executor/execStream.h"
 #include "instruments/instr_event.h"
 #include "instruments/instr_statement.h"
+#include "libpq/libpq.h"
 
 #define NLOCKENTS()                                           \
     mul_size(g_instance.attr.attr_storage.max_locks_per_xact, \
@@ -1616,12 +1617,12 @@ static void ReportWaitLockInfo(const LOCALLOCK *locallock)
 
     if (u_sess->attr.attr_common.enable_instr_track_wait &&
         wait_event_info != WAIT_EVENT_END) {
-        beentry->waitInfo.event_info.start_time = GetCurrentTimestamp();
+        beentry->waitInfo.event_info.start_time = GetCycleClockUsec();
     } else if (u_sess->attr.attr_common.enable_instr_track_wait &&
                old_wait_event_info != WAIT_EVENT_END &&
                wait_event_info == WAIT_EVENT_END) {
         int64 duration =
-            GetCurrentTimestamp() - beentry->waitInfo.event_info.start_time;
+            GetCycleClockUsec() - beentry->waitInfo.event_info.start_time;
         UpdateWaitEventStat(&beentry->waitInfo, old_wait_event_info, duration);
         beentry->waitInfo.event_info.start_time = 0;
     }
@@ -1676,6 +1677,9 @@ static void WaitOnLock(LOCALLOCK *locallock, ResourceOwner owner, bool allow_con
     t_thrd.storage_cxt.awaitedLock = locallock;
     t_thrd.storage_cxt.awaitedOwner = owner;
 
+    /* the lock holder may be waiting for our deferred output, e.g. a COMMIT acknowledgement */
+    pq_flush_deferred();
+
     /*
      * NOTE: Think not to put any shared-state cleanup after the call to
      * ProcSleep, in either the normal or failure path.  The lock state must
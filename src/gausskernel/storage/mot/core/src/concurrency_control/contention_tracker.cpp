@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2020 Huawei Technologies Co.,Ltd.
+ *
+ * openGauss is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *          http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------
+ *
+ * contention_tracker.cpp
+ *    Hot key detection for OCC commit validation.
+ *
+ * IDENTIFICATION
+ *    src/gausskernel/storage/mot/core/src/concurrency_control/contention_tracker.cpp
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "contention_tracker.h"
+#include "occ_transaction_manager.h"
+#include "sentinel.h"
+#include <unistd.h>
+
+namespace MOT {
+uint32_t ContentionTracker::m_abortCounters[ContentionTracker::SLOT_COUNT] = {0};
+
+bool ContentionTracker::WaitHotKey(const Sentinel* sentinel, uint64_t waitTimeoutUSec)
+{
+    uint32_t spinCount = 0;
+    uint64_t waitedUSec = 0;
+
+    // the lock is held by a transaction that already passed validation, so the wait is bounded by its commit time,
+    // which includes the redo log flush. Spin briefly, then sleep like LockHeadersNoWait() does, and give up after
+    // the configured timeout and let commit validation decide
+    while (sentinel->IsLocked()) {
+        if (spinCount < HOT_KEY_LOCK_SPIN_COUNT) {
+            PAUSE
+            ++spinCount;
+        } else if (waitedUSec >= waitTimeoutUSec) {
+            break;
+        } else {
+            (void)usleep(HOT_KEY_SLEEP_USEC);
+            waitedUSec += HOT_KEY_SLEEP_USEC;
+        }
+    }
+    return (spinCount > 0);
+}
+}  // namespace MOT
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020 Huawei Technologies Co.,Ltd.
+ *
+ * openGauss is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *          http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------
+ *
+ * contention_tracker.h
+ *    Hot key detection for OCC commit validation.
+ *
+ * IDENTIFICATION
+ *    src/gausskernel/storage/mot/core/src/concurrency_control/contention_tracker.h
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef CONTENTION_TRACKER_H
+#define CONTENTION_TRACKER_H
+
+#include <cstdint>
+#include "global.h"
+#include "mot_atomic_ops.h"
+
+namespace MOT {
+// forward declaration
+class Sentinel;
+
+/**
+ * @class ContentionTracker
+ * @brief Tracks commit validation aborts per sentinel in order to detect hot keys.
+ * @detail Abort counters are kept in a fixed size array indexed by the sentinel address, so distinct sentinels
+ * may share a counter. A false positive only causes a transaction to use the blocking validation mode, which is
+ * always correct. Counters decay whenever a transaction successfully commits changes to a key.
+ */
+class ContentionTracker {
+public:
+    /**
+     * @brief Records a validation abort caused by the given sentinel.
+     * @param sentinel The conflicting sentinel.
+     */
+    static inline void RecordAbort(const Sentinel* sentinel)
+    {
+        uint32_t& counter = m_abortCounters[GetSlot(sentinel)];
+        if (counter < MAX_ABORT_COUNT) {
+            (void)MOT_ATOMIC_INC(counter);
+        }
+    }
+
+    /**
+     * @brief Records a successful commit of changes to the given sentinel.
+     * @param sentinel The committed sentinel.
+     */
+    static inline void RecordCommit(const Sentinel* sentinel)
+    {
+        uint32_t& counter = m_abortCounters[GetSlot(sentinel)];
+        uint32_t value = counter;
+        if (value > 0) {
+            // lossy decay is good enough, no need to retry
+            (void)__sync_bool_compare_and_swap(&counter, value, value - 1);
+        }
+    }
+
+    /**
+     * @brief Queries whether a sentinel has any recorded validation aborts.
+     * @param sentinel The sentinel to check.
+     * @return True if the sentinel has recorded aborts.
+     */
+    static inline bool IsContended(const Sentinel* sentinel)
+    {
+        return m_abortCounters[GetSlot(sentinel)] > 0;
+    }
+
+    /**
+     * @brief Queries whether a sentinel is a hot key.
+     * @param sentinel The sentinel to check.
+     * @param threshold The abort count threshold (zero means hot key detection is disabled).
+     * @return True if the sentinel is a hot key.
+     */
+    static inline bool IsHotKey(const Sentinel* sentinel, uint32_t threshold)
+    {
+        return (threshold > 0) && (m_abortCounters[GetSlot(sentinel)] >= threshold);
+    }
+
+    /**
+     * @brief Waits until the given hot key sentinel is not locked by a concurrent committer, so that the caller does
+     * not read a row version that is about to be replaced.
+     * @param sentinel The hot key sentinel.
+     * @param waitTimeoutUSec The maximum time to sleep waiting, in microseconds.
+     * @return True if the caller had to wait.
+     */
+    static bool WaitHotKey(const Sentinel* sentinel, uint64_t waitTimeoutUSec);
+
+private:
+    /** @var Sleep time of each round of waiting on a locked hot key, same as LockHeadersNoWait() under contention. */
+    static constexpr uint64_t HOT_KEY_SLEEP_USEC = 100;
+
+    /** @var The number of abort counters (must be a power of two). */
+    static constexpr uint32_t SLOT_COUNT = 1 << 14;
+
+    /** @var Abort counters saturate at this value, so decay takes effect in a reasonable time. */
+    static constexpr uint32_t MAX_ABORT_COUNT = 1024;
+
+    static inline uint32_t GetSlot(const Sentinel* sentinel)
+    {
+        // sentinels are at least 16 bytes apart, use multiplicative hashing to spread neighbors
+        constexpr uint64_t goldenRatio = 0x9E3779B97F4A7C15UL;
+        return (uint32_t)(((((uint64_t)sentinel) >> 4) * goldenRatio) >> 50) & (SLOT_COUNT - 1);
+    }
+
+    /** @var The abort counters. */
+    static uint32_t m_abortCounters[SLOT_COUNT];
+};
+}  // namespace MOT
+
+#endif /* CONTENTION_TRACKER_H */
@@ -23,10 +23,13 @@
  */
 
 #include "occ_transaction_manager.h"
+#include "contention_tracker.h"
+#include "db_session_statistics.h"
 #include "../utils/utilities.h"
 #include "cycles.h"
 #include "mot_engine.h"
 #include "row.h"
+#include "table.h"
 #include "row_header.h"
 #include "txn.h"
 #include "txn_access.h"
@@ -46,6 +49,11 @@ OccTransactionManager::OccTransactionManager()
       m_deleteSetSize(0),
       m_insertSetSize(0),
       m_dynamicSleep(100),
+      m_conflictAccess(nullptr),
+      m_contendedWriteCount(0),
+      m_hotKeyAbortThreshold(0),
+      m_hotKeyWaitTimeoutUSec(0),
+      m_hotKeyTxn(false),
       m_rowsLocked(false),
       m_preAbort(true),
       m_validationNoWait(true)
@@ -57,6 +65,8 @@ OccTransactionManager::~OccTransactionManager()
 bool OccTransactionManager::Init()
 {
     bool result = true;
+    m_hotKeyAbortThreshold = GetGlobalConfiguration().m_occHotKeyAbortThreshold;
+    m_hotKeyWaitTimeoutUSec = GetGlobalConfiguration().m_occHotKeyWaitTimeoutUSec;
     return result;
 }
 
@@ -113,6 +123,7 @@ bool OccTransactionManager::ValidateReadSet(TxnManager* txMan)
             continue;
         }
         if (!ac->GetRowFromHeader()->m_rowHeader.ValidateRead(ac->m_tid)) {
+            m_conflictAccess = ac;
             return false;
         }
     }
@@ -130,6 +141,7 @@ bool OccTransactionManager::ValidateWriteSet(TxnManager* txMan)
         }
 
         if (!QuickHeaderValidation(ac)) {
+            m_conflictAccess = ac;
             return false;
         }
     }
@@ -171,6 +183,7 @@ bool OccTransactionManager::LockHeadersNoWait(TxnManager* txMan, uint32_t& numSe
             }
             Sentinel* sent = ac->m_origSentinel;
             if (!sent->TryLock(thdId)) {
+                m_conflictAccess = ac;
                 break;
             }
             numSentinelsLock++;
@@ -180,6 +193,7 @@ bool OccTransactionManager::LockHeadersNoWait(TxnManager* txMan, uint32_t& numSe
             // New insert row is already committed!
             // Check if row has changed in sentinel
             if (!QuickHeaderValidation(ac)) {
+                m_conflictAccess = ac;
                 return false;
             }
         }
@@ -191,6 +205,7 @@ bool OccTransactionManager::LockHeadersNoWait(TxnManager* txMan, uint32_t& numSe
                 for (const auto& acPair : orderedSet) {
                     const Access* ac = acPair.second;
                     if (!QuickHeaderValidation(ac)) {
+                        m_conflictAccess = ac;
                         return false;
                     }
                 }
@@ -211,13 +226,34 @@ bool OccTransactionManager::LockHeadersNoWait(TxnManager* txMan, uint32_t& numSe
     return true;
 }
 
+bool OccTransactionManager::LockHeaderBounded(Sentinel* sent, uint64_t thdId)
+{
+    uint32_t spinCount = 0;
+    uint64_t waitedUSec = 0;
+    while (!sent->TryLock(thdId)) {
+        if (spinCount < HOT_KEY_LOCK_SPIN_COUNT) {
+            PAUSE
+            ++spinCount;
+        } else if (waitedUSec >= m_hotKeyWaitTimeoutUSec) {
+            return false;
+        } else {
+            (void)usleep(m_dynamicSleep);
+            waitedUSec += m_dynamicSleep;
+        }
+    }
+    return true;
+}
+
 RC OccTransactionManager::LockHeaders(TxnManager* txMan, uint32_t& numSentinelsLock)
 {
     RC rc = RC_OK;
     uint64_t thdId = txMan->GetThdId();
     TxnOrderedSet_t& orderedSet = txMan->m_accessMgr->GetOrderedRowSet();
     numSentinelsLock = 0;
-    if (m_validationNoWait) {
+    // transactions writing hot keys wait for their write set locks instead of aborting on lock contention, which
+    // cannot deadlock since the ordered set is sorted by sentinel address. The wait is still bounded, a stalled lock
+    // holder turns into an abort instead of a hang
+    if (m_validationNoWait && !m_hotKeyTxn) {
         if (!LockHeadersNoWait(txMan, numSentinelsLock)) {
             rc = RC_ABORT;
             goto final;
@@ -229,7 +265,11 @@ RC OccTransactionManager::LockHeaders(TxnManager* txMan, uint32_t& numSentinelsL
                 continue;
             }
             Sentinel* sent = ac->m_origSentinel;
-            sent->Lock(thdId);
+            if (!LockHeaderBounded(sent, thdId)) {
+                m_conflictAccess = ac;
+                rc = RC_ABORT;
+                goto final;
+            }
             numSentinelsLock++;
             if (ac->m_params.IsPrimaryUpgrade()) {
                 ac->m_auxRow->m_rowHeader.Lock();
@@ -237,6 +277,7 @@ RC OccTransactionManager::LockHeaders(TxnManager* txMan, uint32_t& numSentinelsL
             // New insert row is already committed!
             // Check if row has chained in sentinel
             if (!QuickHeaderValidation(ac)) {
+                m_conflictAccess = ac;
                 rc = RC_ABORT;
                 goto final;
             }
@@ -303,8 +344,16 @@ bool OccTransactionManager::QuickVersionCheck(TxnManager* txMan, uint32_t& readS
                 break;
         }
 
+        if (m_hotKeyAbortThreshold > 0 && ac->m_type != RD && ContentionTracker::IsContended(ac->m_origSentinel)) {
+            m_contendedWriteCount++;
+            if (ContentionTracker::IsHotKey(ac->m_origSentinel, m_hotKeyAbortThreshold)) {
+                m_hotKeyTxn = true;
+            }
+        }
+
         if (m_preAbort) {
             if (!QuickHeaderValidation(ac)) {
+                m_conflictAccess = ac;
                 return false;
             }
         }
@@ -324,6 +373,9 @@ RC OccTransactionManager::ValidateOcc(TxnManager* txMan)
     m_rowsSetSize = 0;
     m_deleteSetSize = 0;
     m_insertSetSize = 0;
+    m_conflictAccess = nullptr;
+    m_contendedWriteCount = 0;
+    m_hotKeyTxn = false;
     m_txnCounter++;
 
     if (rowCount == 0) {
@@ -377,9 +429,44 @@ final:
         }
     }
 
+    UpdateContentionState(txMan, rc);
     return rc;
 }
 
+void OccTransactionManager::UpdateContentionState(TxnManager* txMan, RC rc)
+{
+    if (rc == RC_OK) {
+        if (m_hotKeyTxn) {
+            DbSessionStatisticsProvider::GetInstance().AddBlockingValidation();
+        }
+        // let counters of keys that were successfully committed decay
+        if (m_contendedWriteCount > 0) {
+            TxnOrderedSet_t& orderedSet = txMan->m_accessMgr->GetOrderedRowSet();
+            for (const auto& raPair : orderedSet) {
+                const Access* ac = raPair.second;
+                if (ac->m_type != RD) {
+                    ContentionTracker::RecordCommit(ac->m_origSentinel);
+                }
+            }
+        }
+    } else if (rc == RC_ABORT) {
+        DbSessionStatisticsProvider::GetInstance().AddOccAbort();
+        if (m_conflictAccess != nullptr) {
+            if (m_hotKeyAbortThreshold > 0) {
+                ContentionTracker::RecordAbort(m_conflictAccess->m_origSentinel);
+            }
+            Row* row = m_conflictAccess->GetTxnRow();
+            if (row != nullptr && row->GetTable() != nullptr) {
+                row->GetTable()->AddOccAbort();
+            }
+            Index* index = m_conflictAccess->m_origSentinel->GetIndex();
+            if (index != nullptr) {
+                index->AddOccAbort();
+            }
+        }
+    }
+}
+
 void OccTransactionManager::RollbackInserts(TxnManager* txMan)
 {
     return txMan->UndoInserts();
@@ -31,8 +31,12 @@ namespace MOT {
 // forward declaration
 class Access;
 class TxnManager;
+class Sentinel;
 
 constexpr uint64_t LOCK_TIME_OUT = 1 << 16;
+/** @var Busy wait rounds on a locked hot key before sleeping. */
+constexpr uint32_t HOT_KEY_LOCK_SPIN_COUNT = 64;
+
 /**
  * @class OccTransactionManager
  * @brief Optimistic concurrency control implementation.
@@ -158,6 +162,12 @@ private:
 
     bool LockHeadersNoWait(TxnManager* txMan, uint32_t& numSentinelsLock);
 
+    /**
+     * @brief Locks a write set sentinel, spinning briefly and then sleeping like LockHeadersNoWait().
+     * @return False if the lock could not be acquired within the configured hot key wait timeout.
+     */
+    bool LockHeaderBounded(Sentinel* sent, uint64_t thdId);
+
     void ReleaseHeaderLocks(TxnManager* txMan, uint32_t numOfLocks);
 
     /** @brief Release all the locked rows */
@@ -175,6 +185,9 @@ private:
     /** @brief Sets stable row according to the checkpoint state. */
     void ApplyWrite(TxnManager* txMan);
 
+    /** @brief Updates hot key tracking and contention statistics after commit validation. */
+    void UpdateContentionState(TxnManager* txMan, RC rc);
+
     /** @var transaction counter   */
     uint32_t m_txnCounter;
 
@@ -195,6 +208,21 @@ private:
 
     uint16_t m_dynamicSleep;
 
+    /** @var The access that caused the last validation failure. */
+    const Access* m_conflictAccess;
+
+    /** @var Number of write accesses with recorded validation aborts in the current transaction. */
+    uint32_t m_contendedWriteCount;
+
+    /** @var Cached hot key abort threshold (zero when hot key detection is disabled). */
+    uint32_t m_hotKeyAbortThreshold;
+
+    /** @var Cached maximum time to wait for a hot key lock, in microseconds. */
+    uint64_t m_hotKeyWaitTimeoutUSec;
+
+    /** @var flag indicating whether the current transaction writes a hot key. */
+    bool m_hotKeyTxn;
+
     /** @var flag indicating whether we locked the rows   */
     bool m_rowsLocked;
 
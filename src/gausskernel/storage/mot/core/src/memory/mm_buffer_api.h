@@ -66,15 +66,16 @@ extern int MemBufferApiInit();
 extern void MemBufferApiDestroy();
 
 /**
- * @brief Allocates a buffer from the global buffer allocator of the current NUMA node.
+ * @brief Allocates a buffer from the global buffer allocator of the specified NUMA node.
  * @param bufferClass The class of buffer pool from which to allocate a buffer.
+ * @param node The NUMA node identifier.
  * @return The buffer pointer or NULL if allocation failed (i.e. out of memory).
- * @note The global buffer allocator provides buffers from interleaved NUMA pages.
+ * @note If the global buffer allocator of the specified node is depleted, then the buffer is allocated from the
+ * global buffer allocator of another node.
  */
-inline void* MemBufferAllocGlobal(MemBufferClass bufferClass)
+inline void* MemBufferAllocGlobalOnNode(MemBufferClass bufferClass, int node)
 {
     void* buffer = nullptr;
-    int node = MOTCurrentNumaNodeId;
     if (node < 0) {
         MemBufferIssueError(MOT_ERROR_INVALID_ARG,
             "Cannot allocate %s global buffer: Invalid NUMA node identifier %u",
@@ -104,6 +105,17 @@ inline void* MemBufferAllocGlobal(MemBufferClass bufferClass)
     return buffer;
 }
 
+/**
+ * @brief Allocates a buffer from the global buffer allocator of the current NUMA node.
+ * @param bufferClass The class of buffer pool from which to allocate a buffer.
+ * @return The buffer pointer or NULL if allocation failed (i.e. out of memory).
+ * @note The global buffer allocator provides buffers from interleaved NUMA pages.
+ */
+inline void* MemBufferAllocGlobal(MemBufferClass bufferClass)
+{
+    return MemBufferAllocGlobalOnNode(bufferClass, MOTCurrentNumaNodeId);
+}
+
 /**
  * @brief Allocates a buffer from the local buffer allocator of the specified NUMA node.
  * @param bufferClass The class of buffer pool from which to allocate a buffer.
@@ -90,6 +90,7 @@ extern int MemCfgInit()
         g_memGlobalCfg.m_maxConnectionCount);
 
     g_memGlobalCfg.m_chunkAllocPolicy = motCfg.m_chunkAllocPolicy;
+    g_memGlobalCfg.m_rowPlacementPolicy = motCfg.m_rowPlacementPolicy;
     g_memGlobalCfg.m_chunkPreallocWorkerCount = motCfg.m_chunkPreallocWorkerCount;
     g_memGlobalCfg.m_highRedMarkPercent = motCfg.m_highRedMarkPercent;
 
@@ -116,6 +117,15 @@ extern int MemCfgInit()
         }
     }
 
+    // table affinity is meaningful only if global chunks are not interleaved by themselves
+    if ((g_memGlobalCfg.m_rowPlacementPolicy == MEM_ROW_PLACEMENT_TABLE_AFFINITY) &&
+        (g_memGlobalCfg.m_chunkAllocPolicy == MEM_ALLOC_POLICY_PAGE_INTERLEAVED ||
+            g_memGlobalCfg.m_chunkAllocPolicy == MEM_ALLOC_POLICY_CHUNK_INTERLEAVED)) {
+        MOT_LOG_WARN("Row placement policy 'table-affinity' is combined with interleaved chunk allocation policy "
+                     "'%s': table rows will not be confined to a single NUMA node",
+            MemAllocPolicyToString(g_memGlobalCfg.m_chunkAllocPolicy));
+    }
+
     MemCfgPrint("Startup Report", LogLevel::LL_TRACE);
 
     MOT_LOG_TRACE("MM configuration loaded");
@@ -181,6 +191,11 @@ extern void MemCfgToString(int indent, const char* name, StringBuffer* stringBuf
         indent,
         "",
         MemAllocPolicyToString(g_memGlobalCfg.m_chunkAllocPolicy));
+    StringBufferAppend(stringBuffer,
+        "%*sRow Placement Policy: %s\n",
+        indent,
+        "",
+        MemRowPlacementPolicyToString(g_memGlobalCfg.m_rowPlacementPolicy));
     StringBufferAppend(stringBuffer,
         "%*sChunk pre-allocation Worker Count: %u\n",
         indent,
@@ -53,6 +53,7 @@ struct MemCfg {
 
     // chunk pool configuration
     MemAllocPolicy m_chunkAllocPolicy;
+    MemRowPlacementPolicy m_rowPlacementPolicy;
     uint32_t m_chunkPreallocWorkerCount;
     uint32_t m_highRedMarkPercent;
 
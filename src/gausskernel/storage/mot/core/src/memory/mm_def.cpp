@@ -146,4 +146,38 @@ extern const char* MemAllocPolicyToString(MemAllocPolicy allocPolicy)
     }
 }
 
+#define MEM_ROW_PLACEMENT_LOCAL_STR "local"
+#define MEM_ROW_PLACEMENT_INTERLEAVED_STR "interleaved"
+#define MEM_ROW_PLACEMENT_TABLE_AFFINITY_STR "table-affinity"
+
+extern MemRowPlacementPolicy MemRowPlacementPolicyFromString(const char* rowPlacementPolicyStr)
+{
+    MemRowPlacementPolicy result = MEM_ROW_PLACEMENT_INVALID;
+    if (strcmp(rowPlacementPolicyStr, MEM_ROW_PLACEMENT_LOCAL_STR) == 0) {
+        result = MEM_ROW_PLACEMENT_LOCAL;
+    } else if (strcmp(rowPlacementPolicyStr, MEM_ROW_PLACEMENT_INTERLEAVED_STR) == 0) {
+        result = MEM_ROW_PLACEMENT_INTERLEAVED;
+    } else if (strcmp(rowPlacementPolicyStr, MEM_ROW_PLACEMENT_TABLE_AFFINITY_STR) == 0) {
+        result = MEM_ROW_PLACEMENT_TABLE_AFFINITY;
+    }
+    return result;
+}
+
+extern const char* MemRowPlacementPolicyToString(MemRowPlacementPolicy rowPlacementPolicy)
+{
+    switch (rowPlacementPolicy) {
+        case MEM_ROW_PLACEMENT_LOCAL:
+            return MEM_ROW_PLACEMENT_LOCAL_STR;
+
+        case MEM_ROW_PLACEMENT_INTERLEAVED:
+            return MEM_ROW_PLACEMENT_INTERLEAVED_STR;
+
+        case MEM_ROW_PLACEMENT_TABLE_AFFINITY:
+            return MEM_ROW_PLACEMENT_TABLE_AFFINITY_STR;
+
+        default:
+            return "N/A";
+    }
+}
+
 }  // namespace MOT
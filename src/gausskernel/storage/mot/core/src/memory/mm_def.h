@@ -368,6 +368,66 @@ public:
     }
 };
 
+/** @typedef Row placement policy. Determines the NUMA node from which table rows are allocated. */
+enum MemRowPlacementPolicy : uint32_t {
+    /** @var Designates invalid row placement policy. */
+    MEM_ROW_PLACEMENT_INVALID,
+
+    /** @var Rows are allocated from the NUMA node of the inserting session (default). */
+    MEM_ROW_PLACEMENT_LOCAL,
+
+    /** @var Row sub-pools of each table are spread in a round robin fashion over all NUMA nodes. */
+    MEM_ROW_PLACEMENT_INTERLEAVED,
+
+    /** @var All rows of a table are allocated from a single NUMA node, derived from the table identifier. */
+    MEM_ROW_PLACEMENT_TABLE_AFFINITY
+};
+
+/**
+ * @brief Converts string value to row placement policy enumeration.
+ * @param rowPlacementPolicyStr The row placement policy string.
+ * @return The row placement policy enumeration.
+ */
+extern MemRowPlacementPolicy MemRowPlacementPolicyFromString(const char* rowPlacementPolicyStr);
+
+/**
+ * @brief Converts row placement policy enumeration into string form.
+ * @param rowPlacementPolicy The row placement policy.
+ * @return The row placement policy string.
+ */
+extern const char* MemRowPlacementPolicyToString(MemRowPlacementPolicy rowPlacementPolicy);
+
+/**
+ * @class TypeFormatter<MemRowPlacementPolicy>
+ * @brief Specialization of TypeFormatter<T> with [ T = MemRowPlacementPolicy ].
+ */
+template <>
+class TypeFormatter<MemRowPlacementPolicy> {
+public:
+    /**
+     * @brief Converts a value to string.
+     * @param value The value to convert.
+     * @param[out] stringValue The resulting string.
+     */
+    static inline const char* ToString(const MemRowPlacementPolicy& value, mot_string& stringValue)
+    {
+        stringValue = MemRowPlacementPolicyToString(value);
+        return stringValue.c_str();
+    }
+
+    /**
+     * @brief Converts a string to a value.
+     * @param The string to convert.
+     * @param[out] The resulting value.
+     * @return Boolean value denoting whether the conversion succeeded or not.
+     */
+    static inline bool FromString(const char* stringValue, MemRowPlacementPolicy& value)
+    {
+        value = MemRowPlacementPolicyFromString(stringValue);
+        return value != MemRowPlacementPolicy::MEM_ROW_PLACEMENT_INVALID;
+    }
+};
+
 }  // namespace MOT
 
 /** @define Enables/disable entire memory module. */
@@ -52,7 +52,11 @@ void CompactHandler::StartCompaction(CompactTypeT type)
     m_orig->GetStats(stats);
     m_orig->PrintStats(stats, m_logPrefix, LogLevel::LL_INFO);
 
-    if (stats.m_fragmentationPercent <= 0 && stats.m_freeObjCount < stats.m_perPoolTotalCount) {
+    // simple compaction only releases empty pools, other types also pack sparse pools together, which is
+    // worthwhile only if at least one pool can be reclaimed this way
+    uint32_t reclaimable = (type == COMPACT_SIMPLE) ? stats.m_poolFreeCount : GetReclaimablePoolCount(stats);
+    if (reclaimable == 0) {
+        MOT_LOG_TRACE("%s: compaction not needed", m_logPrefix);
         m_compactionNeeded = false;
         return;
     }
@@ -67,8 +71,10 @@ void CompactHandler::StartCompaction(CompactTypeT type)
     p = m_poolsToCompact;
     while (p.Get() != nullptr) {
         ObjPool* op = p.Get();
-        if (p->m_freeCount < p->m_totalCount)
+        // only sparse pools are evacuated, densely occupied pools are kept in place
+        if (p->IsSparse()) {
             m_addrMap[op] = op;
+        }
         p = p->m_objNext;
     }
 }
@@ -108,16 +114,18 @@ void CompactHandler::EndCompaction()
     }
 
     // release compacted pools
+    uint32_t releasedCount = 0;
     if (m_poolsToCompact.Get() != nullptr) {
         ObjPoolPtr p = m_poolsToCompact;
         while (p.Get() != nullptr) {
             ObjPoolPtr tmp = p->m_objNext;
+            ObjPool* op = p.Get();
             if (p->m_freeCount == p->m_totalCount) {
-                ObjPool* op = p.Get();
                 DEL_FROM_LIST(m_orig->m_listLock, m_orig->m_objList, op);
                 ObjPool::DelObjPool(op, m_orig->m_type, true);
+                ++releasedCount;
             } else {
-                if (m_ctype != COMPACT_SIMPLE)
+                if (m_ctype != COMPACT_SIMPLE && m_addrMap.find(op) != m_addrMap.end())
                     MOT_LOG_ERROR("Compaction error: pool not empty, re-inserting to free pools");
                 PUSH(m_orig->m_nextFree, p);
             }
@@ -125,7 +133,12 @@ void CompactHandler::EndCompaction()
         }
     }
 
+    MOT_LOG_INFO("%s: compaction released %u pools (%" PRIu64 " bytes)",
+        m_logPrefix,
+        releasedCount,
+        (uint64_t)releasedCount * 1024 * MemBufferClassToSizeKb(m_orig->m_type));
     m_orig->Print(m_logPrefix, LogLevel::LL_INFO);
+    m_addrMap.clear();
 
     m_compactionNeeded = false;
 }
@@ -57,7 +57,8 @@ public:
     }
     /**
      * @brief Prepares orig for compaction, calculates fragmentation percent, initializes addrMap and set
-     * comactionNeeded to true (if indeed)
+     * comactionNeeded to true (if indeed). Only sparse pools (see @ref ObjPool::IsSparse()) are registered
+     * in addrMap for object relocation.
      */
     void StartCompaction(CompactTypeT type = COMPACT_REALLOC);
     /** @brief Applies new ObjPools to a general use, and releases empty ObjPools.
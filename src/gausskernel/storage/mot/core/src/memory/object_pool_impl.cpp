@@ -96,6 +96,21 @@ inline MemBufferClass ObjAllocInterface::CalcBufferClass(uint16_t size)
     return MemBufferClassLowerBound(pool_size);
 }
 
+void ObjAllocInterface::SetRowPlacement(uint32_t tableId)
+{
+    // row placement applies only to global pools, local pools are served from session memory
+    if (!m_global) {
+        return;
+    }
+    m_placementPolicy = g_memGlobalCfg.m_rowPlacementPolicy;
+    if (m_placementPolicy == MEM_ROW_PLACEMENT_TABLE_AFFINITY) {
+        m_affinityNode = (int16_t)(tableId % g_memGlobalCfg.m_nodeCount);
+    }
+    MOT_LOG_TRACE("Row pool placement policy: %s (affinity node: %d)",
+        MemRowPlacementPolicyToString(m_placementPolicy),
+        (int)m_affinityNode);
+}
+
 void ObjAllocInterface::GetStats(PoolStatsSt& stats)
 {
     ObjPoolPtr p;
@@ -115,40 +130,80 @@ void ObjAllocInterface::GetStats(PoolStatsSt& stats)
     }
     while (p.Get() != NULL) {
         stats.m_poolCount++;
-        if (p->m_totalCount == p->m_freeCount)
+        if (p->m_totalCount == p->m_freeCount) {
             stats.m_poolFreeCount++;
+        } else if (p->IsSparse()) {
+            stats.m_poolSparseCount++;
+            stats.m_sparseObjCount += (p->m_totalCount - p->m_freeCount);
+        }
         stats.m_totalObjCount += p->m_totalCount;
         stats.m_freeObjCount += p->m_freeCount;
+        if (m_global) {
+            MemBufferChunkHeader* chunkHeader = MemBufferChunkGetChunkHeader(p.Get());
+            if (chunkHeader != nullptr && chunkHeader->m_allocatorNode >= 0 &&
+                chunkHeader->m_allocatorNode < MEM_MAX_NUMA_NODES) {
+                stats.m_nodePoolCount[chunkHeader->m_allocatorNode]++;
+            }
+        }
         if (stats.m_type == PoolStatsT::POOL_STATS_ALL)
             p = p->m_next;
         else
             p = p->m_objNext;
     }
 
+    stats.m_remotePlacementCount = MOT_ATOMIC_LOAD(m_remotePlacementCount);
+
     if (stats.m_poolCount > 0)
         stats.m_fragmentationPercent = (int16_t)(stats.m_poolFreeCount * 100 / stats.m_poolCount);
     else
         stats.m_fragmentationPercent = 0;
 }
 
+uint32_t ObjAllocInterface::GetReclaimablePoolCount(const PoolStatsSt& stats)
+{
+    // empty pools are released as is, live objects of sparse pools are packed into as few pools as possible
+    uint32_t reclaimable = stats.m_poolFreeCount;
+    if (stats.m_perPoolTotalCount > 0 && stats.m_poolSparseCount > 0) {
+        uint64_t packedCount = (stats.m_sparseObjCount + stats.m_perPoolTotalCount - 1) / stats.m_perPoolTotalCount;
+        if (packedCount < stats.m_poolSparseCount) {
+            reclaimable += (uint32_t)(stats.m_poolSparseCount - packedCount);
+        }
+    }
+    return reclaimable;
+}
+
 void ObjAllocInterface::PrintStats(PoolStatsSt& stats, const char* prefix, LogLevel level)
 {
     const char* hist_str = "";
 
     MOT_LOG(level,
-        "%s: type: %d, size: %d, pools: %u(%u), total objects: %lu, free objects: %lu"
-        ", overhead: %lu, waist: %lu"
+        "%s: type: %d, size: %d, pools: %u(%u), sparse pools: %u, reclaimable pools: %u (%lu bytes)"
+        ", total objects: %lu, free objects: %lu, overhead: %lu, waist: %lu"
         "\n%s",
         prefix,
         m_type,
         m_size,
         stats.m_poolCount,
         stats.m_poolFreeCount,
+        stats.m_poolSparseCount,
+        GetReclaimablePoolCount(stats),
+        GetReclaimablePoolCount(stats) * stats.m_poolGrossSize,
         stats.m_totalObjCount,
         stats.m_freeObjCount,
         stats.m_poolCount * stats.m_perPoolOverhead,
         stats.m_poolCount * stats.m_perPoolWaist,
         hist_str);
+
+    if (m_global && g_memGlobalCfg.m_nodeCount > 1) {
+        for (uint32_t i = 0; i < g_memGlobalCfg.m_nodeCount && i < MEM_MAX_NUMA_NODES; ++i) {
+            MOT_LOG(level, "%s: node %u pools: %u", prefix, i, stats.m_nodePoolCount[i]);
+        }
+        MOT_LOG(level,
+            "%s: placement policy: %s, remote placements: %lu",
+            prefix,
+            MemRowPlacementPolicyToString(m_placementPolicy),
+            stats.m_remotePlacementCount);
+    }
 }
 
 void ObjAllocInterface::Print(const char* prefix, LogLevel level)
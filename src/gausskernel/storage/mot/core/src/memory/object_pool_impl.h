@@ -50,6 +50,7 @@ namespace MOT {
 #define NOT_VALID (uint8_t)(-1)
 #define G_THREAD_ID ((int16_t)MOTCurrThreadId)
 #define OBJ_INDEX_SIZE 1
+#define OBJ_POOL_SPARSE_PERCENT 50  // sub-pools occupied below this percentage are compaction candidates
 #define MEMORY_BARRIER asm volatile("" ::: "memory");
 
 #define OBJ_RELEASE_START_NOMARK(ptr, size)                                              \
@@ -193,6 +194,10 @@ typedef struct tagPoolStatsSt {
     int16_t m_fragmentationPercent;
     uint32_t m_perPoolOverhead;
     uint32_t m_perPoolWaist;
+    uint32_t m_poolSparseCount;
+    uint64_t m_sparseObjCount;
+    uint32_t m_nodePoolCount[MEM_MAX_NUMA_NODES];
+    uint64_t m_remotePlacementCount;
 } PoolStatsSt;
 
 #if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
@@ -312,10 +317,27 @@ public:
     MemBufferClass m_type;
     bool m_global;
 
+    /** @var The NUMA placement policy of sub-pools (applicable only to global row pools). */
+    MemRowPlacementPolicy m_placementPolicy;
+
+    /** @var The NUMA node of all sub-pools when using table-affinity placement policy. */
+    int16_t m_affinityNode;
+
+    /** @var Round robin counter for interleaved placement policy. */
+    uint64_t m_nextPlacementNode;
+
+    /** @var The number of sub-pools placed on a NUMA node other than the node of the allocating session. */
+    uint64_t m_remotePlacementCount;
+
     static ObjAllocInterface* GetObjPool(uint16_t size, bool local, uint8_t align = 8);
     static void FreeObjPool(ObjAllocInterface** pool);
 
-    explicit ObjAllocInterface(bool isGlobal) : m_global(isGlobal)
+    explicit ObjAllocInterface(bool isGlobal)
+        : m_global(isGlobal),
+          m_placementPolicy(MEM_ROW_PLACEMENT_LOCAL),
+          m_affinityNode(-1),
+          m_nextPlacementNode(0),
+          m_remotePlacementCount(0)
     {}
 
     virtual ~ObjAllocInterface();
@@ -348,7 +370,39 @@ public:
     virtual void ClearThreadCache() = 0;
     virtual void ClearFreeCache() = 0;
 
+    /**
+     * @brief Applies the configured row placement policy to this pool.
+     * @param tableId The identifier of the table owning the pool (used for table-affinity placement).
+     */
+    void SetRowPlacement(uint32_t tableId);
+
+    /**
+     * @brief Selects the NUMA node from which the next sub-pool is to be allocated.
+     * @return The NUMA node identifier.
+     */
+    inline int SelectPlacementNode()
+    {
+        int currentNode = MOTCurrentNumaNodeId;
+        int node = currentNode;
+        if (m_placementPolicy == MEM_ROW_PLACEMENT_INTERLEAVED) {
+            node = (int)((MOT_ATOMIC_INC(m_nextPlacementNode) - 1) % g_memGlobalCfg.m_nodeCount);
+        } else if (m_placementPolicy == MEM_ROW_PLACEMENT_TABLE_AFFINITY) {
+            node = m_affinityNode;
+        }
+        if (node != currentNode) {
+            (void)MOT_ATOMIC_INC(m_remotePlacementCount);
+        }
+        return node;
+    }
+
     void GetStats(PoolStatsSt& stats);
+
+    /**
+     * @brief Computes the number of sub-pools that compaction can return to the buffer allocator.
+     * @param stats The pool statistics (see @ref GetStats()).
+     * @return The number of reclaimable sub-pools.
+     */
+    static uint32_t GetReclaimablePoolCount(const PoolStatsSt& stats);
     void PrintStats(PoolStatsSt& stats, const char* prefix = "", LogLevel level = LogLevel::LL_DEBUG);
     void Print(const char* prefix, LogLevel level = LogLevel::LL_DEBUG);
 
@@ -404,6 +458,13 @@ public:
     ~ObjPool()
     {}
 
+    /** @brief Queries whether the sub-pool is in use but occupied below the sparse threshold. */
+    inline bool IsSparse() const
+    {
+        uint32_t usedCount = (uint32_t)(m_totalCount - m_freeCount);
+        return (usedCount > 0) && (usedCount * 100 < (uint32_t)m_totalCount * OBJ_POOL_SPARSE_PERCENT);
+    }
+
     inline void AllocNoLock(void** ret, PoolAllocStateT* state)
     {
         uint8_t ix = ++(m_head.m_nextFreeObj);
@@ -468,7 +529,7 @@ public:
         void* p;
 
         if (global == true) {
-            p = MemBufferAllocGlobal(type);
+            p = MemBufferAllocGlobalOnNode(type, app->SelectPlacementNode());
         } else {
 #ifdef MEM_SESSION_ACTIVE
             uint32_t bufferSize = 1024 * MemBufferClassToSizeKb(type);
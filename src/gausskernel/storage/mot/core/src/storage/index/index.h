@@ -32,6 +32,7 @@
 #include "txn.h"
 #include "object_pool.h"
 #include "utilities.h"
+#include "mot_atomic_ops.h"
 
 #include <string>
 using namespace std;
@@ -664,6 +665,17 @@ public:
         return m_indexId;
     }
 
+    /** @brief Records a commit validation abort caused by a sentinel of this index. */
+    inline void AddOccAbort()
+    {
+        (void)MOT_ATOMIC_INC(m_occAbortCount);
+    }
+
+    inline uint64_t GetOccAbortCount() const
+    {
+        return m_occAbortCount;
+    }
+
 protected:
     /** @var The length of the key in bytes. */
     uint32_t m_keyLength;
@@ -685,6 +697,9 @@ protected:
 
     uint32_t m_indexId;
 
+    /** @var Number of commit validation aborts caused by sentinels of this index. */
+    uint64_t m_occAbortCount = 0;
+
     uint16_t m_lengthKeyFields[MAX_KEY_COLUMNS] = {0};
     int16_t m_columnKeyFields[MAX_KEY_COLUMNS] = {0};
     int16_t m_numKeyFields = 0;
@@ -120,6 +120,8 @@ bool Table::InitRowPool(bool local)
         MOT_REPORT_ERROR(
             MOT_ERROR_OOM, "Initialize Table", "Failed to allocate row pool for table %s", m_longTableName.c_str());
         result = false;
+    } else {
+        m_rowPool->SetRowPlacement(m_tableId);
     }
     return result;
 }
@@ -777,6 +779,8 @@ void Table::Truncate(TxnManager* txn)
             "Truncate Table",
             "Failed to allocate row pool after truncate in table %s",
             m_longTableName.c_str());
+    } else {
+        m_rowPool->SetRowPlacement(m_tableId);
     }
 
     (void)pthread_rwlock_unlock(&m_rwLock);
@@ -805,12 +809,28 @@ uint64_t Table::GetTableSize()
     }
     uint64_t res = stats.m_poolCount * stats.m_poolGrossSize;
     uint64_t netto = (stats.m_totalObjCount - stats.m_freeObjCount) * stats.m_objSize;
-
-    erc = memset_s(&stats, sizeof(PoolStatsSt), 0, sizeof(PoolStatsSt));
-    securec_check(erc, "\0", "\0");
-    stats.m_type = PoolStatsT::POOL_STATS_ALL;
-
-    MOT_LOG_INFO("Table %s memory size: gross: %lu", m_tableName.c_str(), res);
+    uint64_t reclaimable = ObjAllocInterface::GetReclaimablePoolCount(stats) * stats.m_poolGrossSize;
+
+    MOT_LOG_INFO("Table %s memory size: gross: %lu, net: %lu, sparse pools: %u/%u, reclaimable by compaction: %lu "
+                 "(%lu%%)",
+        m_tableName.c_str(),
+        res,
+        netto,
+        stats.m_poolSparseCount,
+        stats.m_poolCount,
+        reclaimable,
+        (res > 0) ? (reclaimable * 100 / res) : 0);
+    MOT_LOG_INFO("Table %s contention: OCC aborts: %lu, hot key waits: %lu",
+        m_tableName.c_str(),
+        GetOccAbortCount(),
+        GetHotKeyWaitCount());
+    for (int i = 0; i < m_numIndexes; i++) {
+        if (m_indexes[i] != nullptr && m_indexes[i]->GetOccAbortCount() > 0) {
+            MOT_LOG_INFO("Index %s contention: OCC aborts: %lu",
+                m_indexes[i]->GetName().c_str(),
+                m_indexes[i]->GetOccAbortCount());
+        }
+    }
     return res;
 }
 
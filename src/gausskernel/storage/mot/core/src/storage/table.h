@@ -532,6 +532,28 @@ public:
         return m_tableExId;
     }
 
+    /** @brief Records a commit validation abort caused by a row of this table. */
+    inline void AddOccAbort()
+    {
+        (void)MOT_ATOMIC_INC(m_occAbortCount);
+    }
+
+    /** @brief Records a wait for a concurrent committer of a hot key in this table. */
+    inline void AddHotKeyWait()
+    {
+        (void)MOT_ATOMIC_INC(m_hotKeyWaitCount);
+    }
+
+    inline uint64_t GetOccAbortCount() const
+    {
+        return m_occAbortCount;
+    }
+
+    inline uint64_t GetHotKeyWaitCount() const
+    {
+        return m_hotKeyWaitCount;
+    }
+
     /**
      * @brief Retrieves the length of the key in the primary index.
      * @return The primary index key length.
@@ -932,6 +954,12 @@ private:
 
     uint32_t m_rowCount = 0;
 
+    /** @var Number of commit validation aborts caused by rows of this table. */
+    uint64_t m_occAbortCount = 0;
+
+    /** @var Number of times transactions waited for a concurrent committer of a hot key in this table. */
+    uint64_t m_hotKeyWaitCount = 0;
+
     DECLARE_CLASS_LOGGER();
 
 public:
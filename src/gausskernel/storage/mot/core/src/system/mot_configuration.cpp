@@ -58,6 +58,7 @@ constexpr const char* MOTConfiguration::DEFAULT_GROUP_COMMIT_TIMEOUT;
 constexpr uint64_t MOTConfiguration::DEFAULT_GROUP_COMMIT_TIMEOUT_USEC;
 constexpr uint64_t MOTConfiguration::MIN_GROUP_COMMIT_TIMEOUT_USEC;
 constexpr uint64_t MOTConfiguration::MAX_GROUP_COMMIT_TIMEOUT_USEC;
+constexpr bool MOTConfiguration::DEFAULT_ENABLE_EARLY_LOCK_RELEASE;
 // checkpoint configuration members
 constexpr bool MOTConfiguration::DEFAULT_ENABLE_CHECKPOINT;
 constexpr bool MOTConfiguration::DEFAULT_ENABLE_INCREMENTAL_CHECKPOINT;
@@ -74,6 +75,14 @@ constexpr uint32_t MOTConfiguration::DEFAULT_CHECKPOINT_RECOVERY_WORKERS;
 constexpr uint32_t MOTConfiguration::MIN_CHECKPOINT_RECOVERY_WORKERS;
 constexpr uint32_t MOTConfiguration::MAX_CHECKPOINT_RECOVERY_WORKERS;
 constexpr bool MOTConfiguration::DEFAULT_ENABLE_LOG_RECOVERY_STATS;
+// transaction configuration members
+constexpr uint32_t MOTConfiguration::DEFAULT_OCC_HOT_KEY_ABORT_THRESHOLD;
+constexpr uint32_t MOTConfiguration::MIN_OCC_HOT_KEY_ABORT_THRESHOLD;
+constexpr uint32_t MOTConfiguration::MAX_OCC_HOT_KEY_ABORT_THRESHOLD;
+constexpr const char* MOTConfiguration::DEFAULT_OCC_HOT_KEY_WAIT_TIMEOUT;
+constexpr uint64_t MOTConfiguration::DEFAULT_OCC_HOT_KEY_WAIT_TIMEOUT_USEC;
+constexpr uint64_t MOTConfiguration::MIN_OCC_HOT_KEY_WAIT_TIMEOUT_USEC;
+constexpr uint64_t MOTConfiguration::MAX_OCC_HOT_KEY_WAIT_TIMEOUT_USEC;
 // machine configuration members
 constexpr uint16_t MOTConfiguration::DEFAULT_NUMA_NODES;
 constexpr uint16_t MOTConfiguration::DEFAULT_CORES_PER_CPU;
@@ -138,6 +147,7 @@ constexpr uint64_t MOTConfiguration::MAX_MIN_MOT_SESSION_MEMORY_KB;
 constexpr MemReserveMode MOTConfiguration::DEFAULT_RESERVE_MEMORY_MODE;
 constexpr MemStorePolicy MOTConfiguration::DEFAULT_STORE_MEMORY_POLICY;
 constexpr MemAllocPolicy MOTConfiguration::DEFAULT_CHUNK_ALLOC_POLICY;
+constexpr MemRowPlacementPolicy MOTConfiguration::DEFAULT_ROW_PLACEMENT_POLICY;
 constexpr uint32_t MOTConfiguration::DEFAULT_CHUNK_PREALLOC_WORKER_COUNT;
 constexpr uint32_t MOTConfiguration::MIN_CHUNK_PREALLOC_WORKER_COUNT;
 constexpr uint32_t MOTConfiguration::MAX_CHUNK_PREALLOC_WORKER_COUNT;
@@ -353,6 +363,16 @@ static bool ParseChunkAllocPolicy(const std::string& cfgName, const std::string&
     return result;
 }
 
+static bool ParseRowPlacementPolicy(const std::string& cfgName, const std::string& variableName,
+    const std::string& newValue, MemRowPlacementPolicy* variableValue)
+{
+    bool result = (cfgName == variableName);
+    if (result) {
+        *variableValue = MemRowPlacementPolicyFromString(newValue.c_str());
+    }
+    return result;
+}
+
 bool MOTConfiguration::FindNumaNodes(int* maxNodes)
 {
     int error = MotSysNumaAvailable();
@@ -446,6 +466,7 @@ MOTConfiguration::MOTConfiguration()
       m_enableGroupCommit(DEFAULT_ENABLE_GROUP_COMMIT),
       m_groupCommitSize(DEFAULT_GROUP_COMMIT_SIZE),
       m_groupCommitTimeoutUSec(DEFAULT_GROUP_COMMIT_TIMEOUT_USEC),
+      m_enableEarlyLockRelease(DEFAULT_ENABLE_EARLY_LOCK_RELEASE),
       m_enableCheckpoint(DEFAULT_ENABLE_CHECKPOINT),
       m_enableIncrementalCheckpoint(DEFAULT_ENABLE_INCREMENTAL_CHECKPOINT),
       m_checkpointDir(DEFAULT_CHECKPOINT_DIR),
@@ -455,6 +476,8 @@ MOTConfiguration::MOTConfiguration()
       m_abortBufferEnable(true),
       m_preAbort(true),
       m_validationLock(TxnValidation::TXN_VALIDATION_NO_WAIT),
+      m_occHotKeyAbortThreshold(DEFAULT_OCC_HOT_KEY_ABORT_THRESHOLD),
+      m_occHotKeyWaitTimeoutUSec(DEFAULT_OCC_HOT_KEY_WAIT_TIMEOUT_USEC),
       m_numaNodes(DEFAULT_NUMA_NODES),
       m_coresPerCpu(DEFAULT_CORES_PER_CPU),
       m_dataNodeId(DEFAULT_DATA_NODE_ID),
@@ -490,6 +513,7 @@ MOTConfiguration::MOTConfiguration()
       m_reserveMemoryMode(DEFAULT_RESERVE_MEMORY_MODE),
       m_storeMemoryPolicy(DEFAULT_STORE_MEMORY_POLICY),
       m_chunkAllocPolicy(DEFAULT_CHUNK_ALLOC_POLICY),
+      m_rowPlacementPolicy(DEFAULT_ROW_PLACEMENT_POLICY),
       m_chunkPreallocWorkerCount(DEFAULT_CHUNK_PREALLOC_WORKER_COUNT),
       m_highRedMarkPercent(DEFAULT_HIGH_RED_MARK_PERCENT),
       m_sessionLargeBufferStoreSizeMB(DEFAULT_SESSION_LARGE_BUFFER_STORE_SIZE_MB),
@@ -551,6 +575,7 @@ bool MOTConfiguration::SetFlag(const std::string& name, const std::string& value
     } else if (ParseBool(name, "enable_group_commit", value, &m_enableGroupCommit)) {
     } else if (ParseUint64(name, "group_commit_size", value, &m_groupCommitSize)) {
     } else if (ParseUint64(name, "group_commit_timeout_usec", value, &m_groupCommitTimeoutUSec)) {
+    } else if (ParseBool(name, "enable_early_lock_release", value, &m_enableEarlyLockRelease)) {
     } else if (ParseBool(name, "enable_checkpoint", value, &m_enableCheckpoint)) {
     } else if (ParseBool(name, "enable_incremental_checkpoint", value, &m_enableIncrementalCheckpoint)) {
     } else if (ParseString(name, "checkpoint_dir", value, &m_checkpointDir)) {
@@ -560,6 +585,8 @@ bool MOTConfiguration::SetFlag(const std::string& name, const std::string& value
     } else if (ParseBool(name, "abort_buffer_enable", value, &m_abortBufferEnable)) {
     } else if (ParseBool(name, "pre_abort", value, &m_preAbort)) {
     } else if (ParseValidation(name, "validation_lock", value, &m_validationLock)) {
+    } else if (ParseUint32(name, "occ_hot_key_abort_threshold", value, &m_occHotKeyAbortThreshold)) {
+    } else if (ParseUint64(name, "occ_hot_key_wait_timeout_usec", value, &m_occHotKeyWaitTimeoutUSec)) {
     } else if (ParseBool(name, "enable_stats", value, &m_enableStats)) {
     } else if (ParseUint64(name, "stats_period_seconds", value, &m_statPrintPeriodSeconds)) {
     } else if (ParseUint64(name, "full_stats_period_seconds", value, &m_statPrintFullPeriodSeconds)) {
@@ -590,6 +617,7 @@ bool MOTConfiguration::SetFlag(const std::string& name, const std::string& value
     } else if (ParseMemoryReserveMode(name, "reserve_memory_mode", value, &m_reserveMemoryMode)) {
     } else if (ParseMemoryStorePolicy(name, "store_memory_policy", value, &m_storeMemoryPolicy)) {
     } else if (ParseChunkAllocPolicy(name, "chunk_alloc_policy", value, &m_chunkAllocPolicy)) {
+    } else if (ParseRowPlacementPolicy(name, "row_placement_policy", value, &m_rowPlacementPolicy)) {
     } else if (ParseUint32(name, "chunk_prealloc_worker_count", value, &m_chunkPreallocWorkerCount)) {
     } else if (ParseUint32(name, "high_red_mark_percent", value, &m_highRedMarkPercent)) {
     } else if (ParseUint64(name, "session_large_buffer_store_size_mb", value, &m_sessionLargeBufferStoreSizeMB)) {
@@ -845,6 +873,7 @@ void MOTConfiguration::LoadMemConfig()
     UPDATE_USER_CFG(m_reserveMemoryMode, "reserve_memory_mode", DEFAULT_RESERVE_MEMORY_MODE);
     UPDATE_USER_CFG(m_storeMemoryPolicy, "store_memory_policy", DEFAULT_STORE_MEMORY_POLICY);
     UPDATE_USER_CFG(m_chunkAllocPolicy, "chunk_alloc_policy", DEFAULT_CHUNK_ALLOC_POLICY);
+    UPDATE_USER_CFG(m_rowPlacementPolicy, "row_placement_policy", DEFAULT_ROW_PLACEMENT_POLICY);
     UPDATE_INT_CFG(m_chunkPreallocWorkerCount,
         "chunk_prealloc_worker_count",
         DEFAULT_CHUNK_PREALLOC_WORKER_COUNT,
@@ -911,6 +940,13 @@ void MOTConfiguration::LoadConfig()
         SCALE_MICROS,
         MIN_GROUP_COMMIT_TIMEOUT_USEC,
         MAX_GROUP_COMMIT_TIMEOUT_USEC);
+    UPDATE_BOOL_CFG(m_enableEarlyLockRelease, "enable_early_lock_release", DEFAULT_ENABLE_EARLY_LOCK_RELEASE);
+    if (m_enableEarlyLockRelease && !m_enableGroupCommit) {
+        if (m_suppressLog == 0) {
+            MOT_LOG_WARN("Disabling enable_early_lock_release forcibly as group commit is disabled");
+        }
+        UpdateBoolConfigItem(m_enableEarlyLockRelease, false, "enable_early_lock_release");
+    }
 
     // Checkpoint configuration
     if (m_loadExtraParams) {
@@ -950,6 +986,17 @@ void MOTConfiguration::LoadConfig()
         UPDATE_BOOL_CFG(m_preAbort, "tx_pre_abort", true);
         m_validationLock = TxnValidation::TXN_VALIDATION_NO_WAIT;
     }
+    UPDATE_INT_CFG(m_occHotKeyAbortThreshold,
+        "occ_hot_key_abort_threshold",
+        DEFAULT_OCC_HOT_KEY_ABORT_THRESHOLD,
+        MIN_OCC_HOT_KEY_ABORT_THRESHOLD,
+        MAX_OCC_HOT_KEY_ABORT_THRESHOLD);
+    UPDATE_TIME_CFG(m_occHotKeyWaitTimeoutUSec,
+        "occ_hot_key_wait_timeout",
+        DEFAULT_OCC_HOT_KEY_WAIT_TIMEOUT,
+        SCALE_MICROS,
+        MIN_OCC_HOT_KEY_WAIT_TIMEOUT_USEC,
+        MAX_OCC_HOT_KEY_WAIT_TIMEOUT_USEC);
 
     // statistics configuration
     UPDATE_BOOL_CFG(m_enableStats, "enable_stats", DEFAULT_ENABLE_STATS);
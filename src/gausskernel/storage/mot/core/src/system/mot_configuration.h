@@ -160,6 +160,9 @@ public:
     /** @var Timeout in micro-seconds of timed group commit flush policies. */
     uint64_t m_groupCommitTimeoutUSec;
 
+    /** @var Enables releasing row locks of a group commit before the commit group becomes durable. */
+    bool m_enableEarlyLockRelease;
+
     /**********************************************************************/
     // Checkpoint configuration
     /**********************************************************************/
@@ -193,6 +196,15 @@ public:
     bool m_preAbort;
     TxnValidation m_validationLock;
 
+    /**
+     * @var The number of validation aborts on a key, above which the key is considered hot. Zero disables hot key
+     * detection.
+     */
+    uint32_t m_occHotKeyAbortThreshold;
+
+    /** @var The maximum time to wait for a hot key held by a concurrent committer, in microseconds. */
+    uint64_t m_occHotKeyWaitTimeoutUSec;
+
     /**********************************************************************/
     // Machine configuration (not configurable, but loaded from system info)
     /**********************************************************************/
@@ -310,6 +322,9 @@ public:
     /** @var Specifies the chunk allocation policy for the global chunk pools. */
     MemAllocPolicy m_chunkAllocPolicy;
 
+    /** @var Specifies the NUMA placement policy of table rows. */
+    MemRowPlacementPolicy m_rowPlacementPolicy;
+
     /** @var The number of worker threads used to allocate memory chunks for initial memory reservation. */
     uint32_t m_chunkPreallocWorkerCount;
 
@@ -444,6 +459,9 @@ public:
     static constexpr uint64_t MIN_GROUP_COMMIT_TIMEOUT_USEC = 100;
     static constexpr uint64_t MAX_GROUP_COMMIT_TIMEOUT_USEC = 200000;  // 200 ms
 
+    /** @var Default enable early lock release. */
+    static constexpr bool DEFAULT_ENABLE_EARLY_LOCK_RELEASE = false;
+
     /** ------------------ Default Checkpoint Configuration ------------ */
     /** @var Default enable checkpoint. */
     static constexpr bool DEFAULT_ENABLE_CHECKPOINT = true;
@@ -474,6 +492,18 @@ public:
     /** @var Default enable log recovery statistics. */
     static constexpr bool DEFAULT_ENABLE_LOG_RECOVERY_STATS = false;
 
+    /** ------------------ Default Transaction Configuration ------------ */
+    /** @var Default number of validation aborts on a key, above which the key is considered hot. */
+    static constexpr uint32_t DEFAULT_OCC_HOT_KEY_ABORT_THRESHOLD = 0;
+    static constexpr uint32_t MIN_OCC_HOT_KEY_ABORT_THRESHOLD = 0;
+    static constexpr uint32_t MAX_OCC_HOT_KEY_ABORT_THRESHOLD = 1024;
+
+    /** @var Default maximum time to wait for a hot key held by a concurrent committer. */
+    static constexpr const char* DEFAULT_OCC_HOT_KEY_WAIT_TIMEOUT = "2 ms";
+    static constexpr uint64_t DEFAULT_OCC_HOT_KEY_WAIT_TIMEOUT_USEC = 2000;
+    static constexpr uint64_t MIN_OCC_HOT_KEY_WAIT_TIMEOUT_USEC = 100;
+    static constexpr uint64_t MAX_OCC_HOT_KEY_WAIT_TIMEOUT_USEC = 1000000;  // 1 second
+
     /** ------------------ Default Machine Configuration ------------ */
     /** @var Default number of NUMA nodes of the machine. */
     static constexpr uint16_t DEFAULT_NUMA_NODES = 1;
@@ -607,6 +637,9 @@ public:
     /** @var Default chunk allocation policy for global chunk pools. */
     static constexpr MemAllocPolicy DEFAULT_CHUNK_ALLOC_POLICY = MEM_ALLOC_POLICY_AUTO;
 
+    /** @var Default NUMA placement policy of table rows. */
+    static constexpr MemRowPlacementPolicy DEFAULT_ROW_PLACEMENT_POLICY = MEM_ROW_PLACEMENT_LOCAL;
+
     /** @var Default number of workers used to pre-allocate initial memory.  */
     static constexpr uint32_t DEFAULT_CHUNK_PREALLOC_WORKER_COUNT = 8;
     static constexpr uint32_t MIN_CHUNK_PREALLOC_WORKER_COUNT = 1;
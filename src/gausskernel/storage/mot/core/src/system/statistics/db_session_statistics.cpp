@@ -41,7 +41,11 @@ DbSessionThreadStatistics::DbSessionThreadStatistics(uint64_t threadId, void* in
       m_commitTxnCount(MakeName("commit-txn", threadId).c_str()),
       m_rollbackTxnCount(MakeName("rollback-txn", threadId).c_str()),
       m_commitPreparedTxnCount(MakeName("commit-prepared-txn", threadId).c_str()),
-      m_rollbackPreparedTxnCount(MakeName("rollback-prepared-txn", threadId).c_str())
+      m_rollbackPreparedTxnCount(MakeName("rollback-prepared-txn", threadId).c_str()),
+      m_occAbortCount(MakeName("occ-abort", threadId).c_str()),
+      m_hotKeyWaitCount(MakeName("hot-key-wait", threadId).c_str()),
+      m_blockingValidationCount(MakeName("blocking-validation", threadId).c_str()),
+      m_earlyLockReleaseCount(MakeName("early-lock-release", threadId).c_str())
 {
     RegisterStatistics(&m_txnCount);
     RegisterStatistics(&m_rowPerTxnCount);
@@ -52,6 +56,10 @@ DbSessionThreadStatistics::DbSessionThreadStatistics(uint64_t threadId, void* in
     RegisterStatistics(&m_rollbackTxnCount);
     RegisterStatistics(&m_commitPreparedTxnCount);
     RegisterStatistics(&m_rollbackPreparedTxnCount);
+    RegisterStatistics(&m_occAbortCount);
+    RegisterStatistics(&m_hotKeyWaitCount);
+    RegisterStatistics(&m_blockingValidationCount);
+    RegisterStatistics(&m_earlyLockReleaseCount);
 }
 
 TypedStatisticsGenerator<DbSessionThreadStatistics, EmptyGlobalStatistics> DbSessionStatisticsProvider::m_generator;
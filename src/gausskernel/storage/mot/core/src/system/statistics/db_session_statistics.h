@@ -103,6 +103,30 @@ public:
         m_rollbackPreparedTxnCount.AddSample();
     }
 
+    /** @brief Updates the OCC validation abort count statistics. */
+    inline void AddOccAbortCount()
+    {
+        m_occAbortCount.AddSample();
+    }
+
+    /** @brief Updates the hot key wait count statistics. */
+    inline void AddHotKeyWaitCount()
+    {
+        m_hotKeyWaitCount.AddSample();
+    }
+
+    /** @brief Updates the blocking validation count statistics. */
+    inline void AddBlockingValidationCount()
+    {
+        m_blockingValidationCount.AddSample();
+    }
+
+    /** @brief Updates the early lock release count statistics. */
+    inline void AddEarlyLockReleaseCount()
+    {
+        m_earlyLockReleaseCount.AddSample();
+    }
+
 private:
     /** @var The transaction count statistic variable. */
     FrequencyStatisticVariable m_txnCount;
@@ -130,6 +154,18 @@ private:
 
     /** @var The rolled-back-prepared-transaction count statistic variable. */
     FrequencyStatisticVariable m_rollbackPreparedTxnCount;
+
+    /** @var The OCC validation abort count statistic variable. */
+    FrequencyStatisticVariable m_occAbortCount;
+
+    /** @var The hot key wait count statistic variable. */
+    FrequencyStatisticVariable m_hotKeyWaitCount;
+
+    /** @var The blocking validation (hot key transaction) count statistic variable. */
+    FrequencyStatisticVariable m_blockingValidationCount;
+
+    /** @var The early lock release count statistic variable. */
+    FrequencyStatisticVariable m_earlyLockReleaseCount;
 };
 
 /**
@@ -235,6 +271,42 @@ public:
         }
     }
 
+    /** @brief Records an OCC validation abort event. */
+    inline void AddOccAbort()
+    {
+        DbSessionThreadStatistics* dbts = GetCurrentThreadStatistics<DbSessionThreadStatistics>();
+        if (dbts != nullptr) {
+            dbts->AddOccAbortCount();
+        }
+    }
+
+    /** @brief Records a hot key wait event. */
+    inline void AddHotKeyWait()
+    {
+        DbSessionThreadStatistics* dbts = GetCurrentThreadStatistics<DbSessionThreadStatistics>();
+        if (dbts != nullptr) {
+            dbts->AddHotKeyWaitCount();
+        }
+    }
+
+    /** @brief Records a blocking validation event. */
+    inline void AddBlockingValidation()
+    {
+        DbSessionThreadStatistics* dbts = GetCurrentThreadStatistics<DbSessionThreadStatistics>();
+        if (dbts != nullptr) {
+            dbts->AddBlockingValidationCount();
+        }
+    }
+
+    /** @brief Records a commit that released its row locks before the log was flushed. */
+    inline void AddEarlyLockRelease()
+    {
+        DbSessionThreadStatistics* dbts = GetCurrentThreadStatistics<DbSessionThreadStatistics>();
+        if (dbts != nullptr) {
+            dbts->AddEarlyLockReleaseCount();
+        }
+    }
+
     /**
      * @brief Derives classes should react to a notification that configuration changed. New
      * configuration is accessible via the ConfigManager.
@@ -249,9 +249,24 @@ void TxnManager::CommitInternal()
 
     if (!GetGlobalConfiguration().m_enableRedoLog) {
         m_occManager.ReleaseLocks(this);
+    } else if (IsEarlyLockReleaseEnabled() && m_redoLog.IsFlushed()) {
+        // the commit group of this transaction was already written to the log, so any transaction that observes
+        // the released rows and then commits, writes its own commit after ours
+        GetRedoLogHandler()->BeginEarlyLockRelease();
+        m_earlyLockReleased = true;
+        m_occManager.ReleaseLocks(this);
+        MOT::DbSessionStatisticsProvider::GetInstance().AddEarlyLockRelease();
     }
 }
 
+bool TxnManager::IsEarlyLockReleaseEnabled() const
+{
+    const MOTConfiguration& cfg = GetGlobalConfiguration();
+    return cfg.m_enableEarlyLockRelease &&
+           (cfg.m_redoLogHandlerType == RedoLogHandlerType::SEGMENTED_GROUP_SYNC_REDO_LOG_HANDLER) &&
+           !MOTEngine::GetInstance()->IsRecovering();
+}
+
 RC TxnManager::ValidateCommit()
 {
     return m_occManager.ValidateOcc(this);
@@ -320,6 +335,14 @@ void TxnManager::EndTransaction()
     if (GetGlobalConfiguration().m_enableRedoLog) {
         m_occManager.ReleaseLocks(this);
     }
+    // if locks were released early, the envelope has already flushed the log up to our commit record, and Cleanup()
+    // unregisters the transaction
+    if (!m_earlyLockReleased && IsEarlyLockReleaseEnabled() && !m_redoLog.IsFlushed() &&
+        !m_accessMgr->GetOrderedRowSet().empty()) {
+        // a transaction that did not write to the log might have observed rows of transactions that released their
+        // locks early, so it must not report commit before these are durable
+        GetRedoLogHandler()->WaitEarlyLockReleaseDurable();
+    }
     CleanDDLChanges();
     Cleanup();
 }
@@ -335,6 +358,11 @@ void TxnManager::RedoWriteAction(bool isCommit)
 
 void TxnManager::Cleanup()
 {
+    // every way out of the transaction passes here, also when it fails after releasing its locks early
+    if (m_earlyLockReleased) {
+        GetRedoLogHandler()->EndEarlyLockRelease();
+        m_earlyLockReleased = false;
+    }
     if (m_isLightSession == false) {
         m_accessMgr->ClearSet();
     }
@@ -636,6 +664,7 @@ TxnManager::TxnManager(SessionContext* session_context)
       m_replayLsn(0),
       m_surrogateGen(),
       m_flushDone(false),
+      m_earlyLockReleased(false),
       m_internalTransactionId(((uint64_t)m_sessionContext->GetSessionId()) << SESSION_ID_BITS),
       m_internalStmtCount(0),
       m_isolationLevel(READ_COMMITED),
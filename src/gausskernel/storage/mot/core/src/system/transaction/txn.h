@@ -468,6 +468,9 @@ private:
      */
     void CommitInternal();
 
+    /** @brief Queries whether row locks are released once the commit group is written to the log. */
+    bool IsEarlyLockReleaseEnabled() const;
+
     void RollbackInternal(bool isPrepared);
 
     // Disable class level new operator
@@ -537,6 +540,9 @@ private:
 
     bool m_flushDone;
 
+    /** @var Specifies whether row locks were released before the redo of this transaction became durable. */
+    bool m_earlyLockReleased;
+
     /** @var internal_transaction_id Generated by txn_manager. */
     /** It is a concatenation of session_id and a counter */
     uint64_t m_internalTransactionId;
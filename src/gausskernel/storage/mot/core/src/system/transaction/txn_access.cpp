@@ -29,6 +29,9 @@
 #include "txn.h"
 #include "txn_access.h"
 #include "txn_insert_action.h"
+#include "contention_tracker.h"
+#include "db_session_statistics.h"
+#include "mot_configuration.h"
 
 namespace MOT {
 IMPLEMENT_CLASS_LOGGER(TxnInsertAction, TxMan);
@@ -496,6 +499,16 @@ Row* TxnAccess::MapRowtoLocalTable(const AccessType type, Sentinel* const& origi
     Access* current_access = nullptr;
     rc = RC_OK;
 
+    // for hot keys, wait for a concurrent committer instead of reading a version that is about to be replaced
+    if (type != RD) {
+        const Sentinel* primarySentinel = reinterpret_cast<const Sentinel*>(originalSentinel->GetPrimarySentinel());
+        if (ContentionTracker::IsHotKey(primarySentinel, GetGlobalConfiguration().m_occHotKeyAbortThreshold) &&
+            ContentionTracker::WaitHotKey(primarySentinel, GetGlobalConfiguration().m_occHotKeyWaitTimeoutUSec)) {
+            DbSessionStatisticsProvider::GetInstance().AddHotKeyWait();
+            originalSentinel->GetData()->GetTable()->AddHotKeyWait();
+        }
+    }
+
     current_access = GetNewRowAccess(originalSentinel->GetData(), type, rc);
     // Check if draft is valid
     if (current_access == nullptr)
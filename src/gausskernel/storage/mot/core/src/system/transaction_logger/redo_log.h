@@ -170,6 +170,12 @@ public:
         return *m_redoBuffer;
     }
 
+    /** @brief Queries whether any redo of the transaction was written to the log. */
+    inline bool IsFlushed() const
+    {
+        return m_flushed;
+    }
+
 private:
     /* Map of Index ID to DDLAccess. */
     typedef std::map<uint64_t, TxnDDLAccess::DDLAccess*> IdxDDLAccessMap;
@@ -75,7 +75,12 @@ RedoLogHandler* RedoLogHandlerFactory::CreateRedoLogHandler()
     return handler;
 }
 
-RedoLogHandler::RedoLogHandler() : m_logger(LoggerFactory::CreateLogger()), m_redo_lock(), m_wakeupFunc(nullptr)
+RedoLogHandler::RedoLogHandler()
+    : m_logger(LoggerFactory::CreateLogger()),
+      m_redo_lock(),
+      m_wakeupFunc(nullptr),
+      m_flushFunc(nullptr),
+      m_earlyLockReleaseCount(0)
 {}
 
 RedoLogHandler::~RedoLogHandler()
@@ -25,6 +25,7 @@
 #ifndef REDO_LOG_HANDLER_H
 #define REDO_LOG_HANDLER_H
 
+#include <atomic>
 #include "ilogger.h"
 #include "txn.h"
 #include "redo_log_buffer.h"
@@ -34,6 +35,12 @@ namespace MOT {
 /** @typedef Callback for waking up WAL writer in the envelope. */
 typedef void (*WalWakeupFunc)();
 
+/**
+ * @typedef Callback for flushing the envelope WAL up to its current insert position, and waiting for synchronous
+ * standbys to acknowledge it.
+ */
+typedef void (*WalFlushFunc)();
+
 /**
  * @class RedoLogHandler
  * @brief abstract interface of a redo logger
@@ -94,6 +101,38 @@ public:
         m_wakeupFunc = wakeupFunc;
     }
 
+    void SetWalFlushFunc(WalFlushFunc flushFunc)
+    {
+        m_flushFunc = flushFunc;
+    }
+
+    /**
+     * @brief Registers a transaction that released its locks after its redo was written to the log, but before the
+     * log was flushed (early lock release).
+     */
+    inline void BeginEarlyLockRelease()
+    {
+        (void)m_earlyLockReleaseCount.fetch_add(1);
+    }
+
+    /** @brief Unregisters a transaction that released its locks early, after its redo became durable. */
+    inline void EndEarlyLockRelease()
+    {
+        (void)m_earlyLockReleaseCount.fetch_sub(1);
+    }
+
+    /**
+     * @brief Makes sure that the redo of all transactions that released their locks early is durable. This is
+     * required before a transaction that did not write to the log reports commit, since it might have observed
+     * changes of such transactions.
+     */
+    inline void WaitEarlyLockReleaseDurable()
+    {
+        if ((m_earlyLockReleaseCount.load() > 0) && (m_flushFunc != nullptr)) {
+            m_flushFunc();
+        }
+    }
+
     inline void RdLock()
     {
         m_redo_lock.RdLock();
@@ -127,6 +166,11 @@ protected:
 
 private:
     WalWakeupFunc m_wakeupFunc;
+
+    WalFlushFunc m_flushFunc;
+
+    /** @var The number of transactions that released their locks early and are not yet known to be durable. */
+    std::atomic<uint64_t> m_earlyLockReleaseCount;
 };
 
 /**
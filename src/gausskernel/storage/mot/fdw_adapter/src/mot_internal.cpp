@@ -31,6 +31,8 @@
 #include "postgres.h"
 #include "access/dfs/dfs_query.h"
 #include "access/sysattr.h"
+#include "access/xlog.h"
+#include "replication/syncrep.h"
 #include "nodes/parsenodes.h"
 #include "nodes/pg_list.h"
 #include "nodes/nodeFuncs.h"
@@ -239,6 +241,16 @@ static void WakeupWalWriter()
     }
 }
 
+static void FlushWal()
+{
+    XLogRecPtr lsn = GetXLogInsertEndRecPtr();
+    XLogWaitFlush(lsn);
+    /* with synchronous replication, commit is only reported once the standbys have the records too */
+    if (u_sess->attr.attr_storage.guc_synchronous_commit > SYNCHRONOUS_COMMIT_LOCAL_FLUSH) {
+        SyncRepWaitForLSN(lsn);
+    }
+}
+
 void MOTAdaptor::Init()
 {
     if (m_initialized) {
@@ -325,6 +337,7 @@ void MOTAdaptor::Init()
     if (motCfg.m_enableRedoLog && motCfg.m_loggerType == MOT::LoggerType::EXTERNAL_LOGGER) {
         m_engine->GetRedoLogHandler()->SetLogger(&xlogger);
         m_engine->GetRedoLogHandler()->SetWalWakeupFunc(WakeupWalWriter);
+        m_engine->GetRedoLogHandler()->SetWalFlushFunc(FlushWal);
     }
 
     InitSessionDetailsMap();
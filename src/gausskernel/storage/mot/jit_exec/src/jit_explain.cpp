@@ -640,6 +640,9 @@ static void ExplainAggregateOperator(int indent, const JitAggregate* aggregate,
     if (aggregate->_distinct) {
         MOT_LOG_APPEND(MOT::LogLevel::LL_TRACE, ")");
     }
+    if (aggregate->_grouped) {
+        MOT_LOG_APPEND(MOT::LogLevel::LL_TRACE, " GROUP BY index prefix");
+    }
     if (!isSubQuery) {
         MOT_LOG_END(MOT::LogLevel::LL_TRACE);
     }
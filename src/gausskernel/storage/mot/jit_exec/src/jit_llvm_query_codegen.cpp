@@ -965,8 +965,11 @@ static JitContext* JitAggregateRangeSelectCodegen(
     }
 
     // if a limit clause exists, then increment limit counter and check if reached limit
-    if (plan->_limit_count > 0) {
+    // (the limit counter also serves to count aggregated rows of a grouped aggregation)
+    if ((plan->_limit_count > 0) || plan->_aggregate._grouped) {
         AddIncrementStateLimitCounter(ctx);
+    }
+    if (plan->_limit_count > 0) {
         JIT_IF_BEGIN(limit_count_reached)
         llvm::Value* current_limit_count = AddGetStateLimitCounter(ctx);
         JIT_IF_EVAL_CMP(current_limit_count, JIT_CONST(plan->_limit_count), JIT_ICMP_EQ);
@@ -983,6 +986,17 @@ static JitContext* JitAggregateRangeSelectCodegen(
     // wrap up aggregation and write to result tuple
     buildAggregateResult(ctx, &plan->_aggregate);
 
+    // a grouped aggregation over an empty range yields no group, so we leave the result tuple empty
+    if (plan->_aggregate._grouped) {
+        JIT_IF_BEGIN(empty_group)
+        llvm::Value* aggregated_count = AddGetStateLimitCounter(ctx);
+        JIT_IF_EVAL_CMP(aggregated_count, JIT_CONST(0), JIT_ICMP_EQ);
+        IssueDebugLog("No row found for grouped aggregation, signaling scan ended with empty result tuple");
+        AddSetScanEnded(ctx, 1);
+        JIT_RETURN_CONST(MOT::RC_OK);
+        JIT_IF_END()
+    }
+
     // store the result tuple
     AddExecStoreVirtualTuple(ctx);
 
@@ -86,7 +86,8 @@ static bool countWhereClauseEqualsLeaves(Query* query, MOT::Table* table, MOT::I
         return false;                                                            \
     }
 
-static bool CheckQueryAttributes(const Query* query, bool allowSorting, bool allowAggregate, bool allowSublink)
+static bool CheckQueryAttributes(
+    const Query* query, bool allowSorting, bool allowAggregate, bool allowSublink, bool allowGrouping = false)
 {
     checkJittableAttribute(query, hasWindowFuncs);
     checkJittableAttribute(query, hasDistinctOn);
@@ -94,7 +95,6 @@ static bool CheckQueryAttributes(const Query* query, bool allowSorting, bool all
     checkJittableAttribute(query, hasModifyingCTE);
 
     checkJittableClause(query, returningList);
-    checkJittableClause(query, groupClause);
     checkJittableClause(query, groupingSets);
     checkJittableClause(query, havingQual);
     checkJittableClause(query, windowClause);
@@ -114,6 +114,13 @@ static bool CheckQueryAttributes(const Query* query, bool allowSorting, bool all
         checkJittableAttribute(query, hasSubLinks);
     }
 
+    if (!allowGrouping) {
+        checkJittableClause(query, groupClause);
+    } else if ((query->groupClause != nullptr) && !query->hasAggs) {
+        MOT_LOG_TRACE("Query is not jittable: groupClause clause without aggregate");
+        return false;
+    }
+
     return true;
 }
 
@@ -520,6 +527,68 @@ static bool isPlanSortOrderValid(Query* query, JitRangeSelectPlan* plan)
     return result;
 }
 
+static int getScanEqualsColumnCount(const JitIndexScan* index_scan)
+{
+    // count the leading index columns that are bound with an EQUALS operator (the last column in an open or semi-open
+    // scan is bound by a range operator)
+    int result = 0;
+    switch (index_scan->_scan_type) {
+        case JIT_INDEX_SCAN_CLOSED:
+        case JIT_INDEX_SCAN_POINT:
+            result = index_scan->_column_count;
+            break;
+
+        case JIT_INDEX_SCAN_OPEN:
+        case JIT_INDEX_SCAN_SEMI_OPEN:
+            result = index_scan->_column_count - 1;
+            break;
+
+        default:
+            break;
+    }
+    return result;
+}
+
+static bool isPlanGroupingValid(Query* query, JitRangeSelectPlan* plan)
+{
+    // a GROUP BY clause is jittable only if all grouped columns are bound by EQUALS operator in the index scan, so that
+    // the scan yields at most one group, which can be computed by a single aggregation loop
+    if (query->groupClause == nullptr) {
+        return true;
+    }
+
+    MOT::Table* table = plan->_index_scan._table;
+    MOT::Index* index = table->GetIndex(plan->_index_scan._index_id);
+    int equals_column_count = getScanEqualsColumnCount(&plan->_index_scan);
+
+    ListCell* lc = nullptr;
+    foreach (lc, query->groupClause) {
+        SortGroupClause* sgc = (SortGroupClause*)lfirst(lc);
+        TargetEntry* te = getRefTargetEntry(query->targetList, sgc->tleSortGroupRef);
+        if (te == nullptr) {
+            MOT_LOG_TRACE("isPlanGroupingValid(): Cannot find TargetEntry by ref-index %d", sgc->tleSortGroupRef);
+            return false;
+        }
+
+        if (te->expr->type != T_Var) {
+            MOT_LOG_TRACE("isPlanGroupingValid(): TargetEntry sub-expression is not Var expression");
+            return false;
+        }
+
+        int table_column_id = ((Var*)te->expr)->varattno;
+        int index_column_id = MapTableColumnToIndex(table, index, table_column_id);
+        if ((index_column_id < 0) || (index_column_id >= equals_column_count)) {
+            MOT_LOG_TRACE("isPlanGroupingValid(): Disqualifying plan - GROUP BY clause references table column %d "
+                          "which is not bound by EQUALS operator in index %s",
+                table_column_id,
+                index->GetName().c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
+
 static int evalConstExpr(Expr* expr)
 {
     int result = -1;
@@ -778,7 +847,7 @@ static bool getAggregateOperator(Query* query, JitAggregate* aggregate)
     ListCell* lc = nullptr;
 
     bool aggregate_found = false;
-    int entry_count = list_length(query->targetList);
+    int entry_count = getNonJunkTargetEntryCount(query);  // grouped columns may appear as junk entries
 
     foreach (lc, query->targetList) {
         TargetEntry* target_entry = (TargetEntry*)lfirst(lc);
@@ -788,8 +857,11 @@ static bool getAggregateOperator(Query* query, JitAggregate* aggregate)
             if (entry_count != 1) {
                 MOT_LOG_TRACE(
                     "getAggregateOperator(): Disqualifying query - aggregate must specify only 1 target entry");
+                result = false;
+                break;
             }
             result = getTargetEntryAggregateOperator(query, target_entry, aggregate);
+            aggregate->_grouped = (query->groupClause != nullptr);
         }
     }
 
@@ -1021,7 +1093,7 @@ static JitPlan* JitPrepareRangeSelectPlan(Query* query, MOT::Table* table, JoinC
 
     // the limit count and aggregation can be inferred regardless of plan
     int limit_count = 0;
-    JitAggregate aggregate = {JIT_AGGREGATE_NONE, 0, 0, nullptr, 0, 0, 0, false};
+    JitAggregate aggregate = {JIT_AGGREGATE_NONE, 0, 0, nullptr, 0, 0, 0, false, false};
     if (!getLimitCount(query, &limit_count) || !getAggregateOperator(query, &aggregate)) {
         MOT_LOG_TRACE(
             "JitPrepareRangeSelectPlan(): Disqualifying query - unsupported scan limit count or aggregate operation");
@@ -1030,6 +1102,19 @@ static JitPlan* JitPrepareRangeSelectPlan(Query* query, MOT::Table* table, JoinC
 
     // now we search for the best index/plan
     bool has_aggregate = (aggregate._aggreaget_op != JIT_AGGREGATE_NONE);
+    if ((query->groupClause != nullptr) && !has_aggregate) {
+        MOT_LOG_TRACE("JitPrepareRangeSelectPlan(): Disqualifying query - GROUP BY clause without simple aggregate");
+        return nullptr;
+    }
+    if (aggregate._grouped && (query->limitCount != nullptr)) {
+        // LIMIT counts groups, not aggregated rows, and the scan yields at most one group, so any positive limit
+        // leaves the result intact (the jitted loop must not stop aggregating after limit_count rows)
+        if (limit_count < 1) {
+            MOT_LOG_TRACE("JitPrepareRangeSelectPlan(): Disqualifying query - non-positive limit on grouped aggregate");
+            return nullptr;
+        }
+        limit_count = 0;
+    }
     size_t alloc_size = sizeof(JitRangeSelectPlan);
 
     for (int index_id = 0; index_id < (int)table->GetNumIndexes(); ++index_id) {
@@ -1056,6 +1141,9 @@ static JitPlan* JitPrepareRangeSelectPlan(Query* query, MOT::Table* table, JoinC
         if (!isPlanSortOrderValid(query, next_plan)) {
             MOT_LOG_TRACE("Disqualifying plan - Query sort order is incompatible with index");
             JitDestroyPlan((JitPlan*)next_plan);
+        } else if (!isPlanGroupingValid(query, next_plan)) {
+            MOT_LOG_TRACE("Disqualifying plan - Query grouping is incompatible with index scan");
+            JitDestroyPlan((JitPlan*)next_plan);
         } else {
             next_plan->_index_scan._sort_order = GetQuerySortOrder(query);
             next_plan->_index_scan._scan_direction = (next_plan->_index_scan._sort_order == JIT_QUERY_SORT_ASCENDING)
@@ -1151,8 +1239,8 @@ static JitPlan* JitPrepareSimplePlan(Query* query)
                     plan = JitPrepareRangeUpdatePlan(query, table);
                 }
             } else if (query->commandType == CMD_SELECT) {
-                if (!CheckQueryAttributes(
-                        query, true, true, false)) {  // range select can specify sort clause or aggregate clause
+                // range select can specify sort clause, aggregate clause or group clause
+                if (!CheckQueryAttributes(query, true, true, false, true)) {
                     MOT_LOG_TRACE(
                         "JitPrepareSimplePlan(): Disqualifying range select query - Invalid query attributes");
                 } else {
@@ -453,6 +453,9 @@ struct JitAggregate {
 
     /** @var Specifies whether this is a distinct aggregation. */
     bool _distinct;
+
+    /** @var Specifies whether the aggregation computes a single GROUP BY group (no result row if group is empty). */
+    bool _grouped;
 };
 
 /** @struct Specifies join of an outer column with an inner column. */
@@ -44,6 +44,9 @@
 #include "utils/timestamp.h"
 #include "postmaster/syslogger.h"
 #include "pgxc/pgxc.h"
+#include "lz4.h"
+
+#include <arpa/inet.h>
 
 /* t_thrd.proc_cxt.DataDir */
 #include "miscadmin.h"
@@ -55,6 +58,7 @@ typedef struct {
     bool nowait;
     bool includewal;
     bool sendtblspcmapfile;
+    bool compress;
 } basebackup_options;
 
 #define BUILD_PATH_LEN 2560 /* (MAXPGPATH*2 + 512) */
@@ -90,6 +94,7 @@ int64 sendTablespace(const char *path, bool sizeonly);
 static bool sendFile(char *readfilename, char *tarfilename, struct stat *statbuf, bool missing_ok);
 static void sendFileWithContent(const char *filename, const char *content);
 static void _tarWriteHeader(const char *filename, const char *linktarget, struct stat *statbuf);
+static int SendTarData(const char *data, size_t len);
 static void send_int8_string(StringInfoData *buf, int64 intval);
 static void SendBackupHeader(List *tablespaces);
 #ifdef ENABLE_MOT
@@ -485,7 +490,7 @@ static void perform_base_backup(basebackup_options *opt, DIR *tblspcdir)
             while ((cnt = fread(buf, 1, Min((uint32)sizeof(buf), XLogSegSize - len), fp)) > 0) {
                 CheckXLogRemoved(segno, tli);
                 /* Send the chunk as a CopyData message */
-                if (pq_putmessage('d', buf, cnt)) {
+                if (SendTarData(buf, cnt)) {
                     ereport(ERROR, (errmsg("base backup could not send data, aborting backup")));
                 }
 
@@ -578,6 +583,7 @@ void PerformMotCheckpointFetch()
     size_t basePathLen = 0;
 
     MOTCheckpointFetchLock();
+    t_thrd.basebackup_cxt.compress = false;
     PG_ENSURE_ERROR_CLEANUP(mot_checkpoint_fetch_cleanup, (Datum)0);
     {
         if (MOTCheckpointExists(ctrlFilePath, MAXPGPATH, fullChkptDir, MAXPGPATH, basePathLen) == false) {
@@ -627,6 +633,7 @@ static void parse_basebackup_options(List *options, basebackup_options *opt)
     bool o_nowait = false;
     bool o_wal = false;
     bool o_tablespace_map = false;
+    bool o_compress = false;
     errno_t rc = memset_s(opt, sizeof(*opt), 0, sizeof(*opt));
     securec_check(rc, "", "");
     foreach (lopt, options) {
@@ -662,6 +669,12 @@ static void parse_basebackup_options(List *options, basebackup_options *opt)
             }
             opt->sendtblspcmapfile = true;
             o_tablespace_map = true;
+        } else if (strcmp(defel->defname, "compress") == 0) {
+            if (o_compress) {
+                ereport(ERROR, (errcode(ERRCODE_SYNTAX_ERROR), errmsg("duplicate option \"%s\"", defel->defname)));
+            }
+            opt->compress = true;
+            o_compress = true;
         } else
             ereport(ERROR, (errcode(ERRCODE_SYNTAX_ERROR), errmsg("option \"%s\" not recognized", defel->defname)));
     }
@@ -684,6 +697,7 @@ void SendBaseBackup(BaseBackupCmd *cmd)
     basebackup_options opt;
 
     parse_basebackup_options(cmd->options, &opt);
+    t_thrd.basebackup_cxt.compress = opt.compress;
 
     backup_context = AllocSetContextCreate(CurrentMemoryContext, "Streaming base backup context",
                                            ALLOCSET_DEFAULT_MINSIZE, ALLOCSET_DEFAULT_INITSIZE,
@@ -713,6 +727,7 @@ void SendBaseBackup(BaseBackupCmd *cmd)
     send_xlog_location();
 
     perform_base_backup(&opt, dir);
+    t_thrd.basebackup_cxt.compress = false;
 
     FreeDir(dir);
 
@@ -917,7 +932,7 @@ static void sendFileWithContent(const char *filename, const char *content)
 
     _tarWriteHeader(filename, NULL, &statbuf);
     /* Send the contents as a CopyData message */
-    (void)pq_putmessage_noblock('d', content, len);
+    (void)SendTarData(content, len);
 
     /* Pad to 512 byte boundary, per tar format requirements */
     pad = ((len + 511) & ~511) - len;
@@ -927,7 +942,7 @@ static void sendFileWithContent(const char *filename, const char *content)
 
         rc = memset_s(buf, sizeof(buf), 0, pad);
         securec_check(rc, "", "");
-        (void)pq_putmessage_noblock('d', buf, pad);
+        (void)SendTarData(buf, pad);
     }
 }
 
@@ -1698,7 +1713,7 @@ static bool sendFile(char *readfilename, char *tarfilename, struct stat *statbuf
         }
 
         /* Send the chunk as a CopyData message */
-        if (pq_putmessage_noblock('d', t_thrd.basebackup_cxt.buf_block, cnt))
+        if (SendTarData(t_thrd.basebackup_cxt.buf_block, cnt))
             ereport(ERROR, (errcode_for_file_access(), errmsg("base backup could not send data, aborting backup")));
 
         len += cnt;
@@ -1719,7 +1734,7 @@ static bool sendFile(char *readfilename, char *tarfilename, struct stat *statbuf
         securec_check(rc, "", "");
         while (len < statbuf->st_size) {
             cnt = Min(TAR_SEND_SIZE, statbuf->st_size - len);
-            (void)pq_putmessage_noblock('d', t_thrd.basebackup_cxt.buf_block, cnt);
+            (void)SendTarData(t_thrd.basebackup_cxt.buf_block, cnt);
             len += cnt;
         }
     }
@@ -1729,7 +1744,7 @@ static bool sendFile(char *readfilename, char *tarfilename, struct stat *statbuf
     if (pad > 0) {
         rc = memset_s(t_thrd.basebackup_cxt.buf_block, pad, 0, pad);
         securec_check(rc, "", "");
-        (void)pq_putmessage_noblock('d', t_thrd.basebackup_cxt.buf_block, pad);
+        (void)SendTarData(t_thrd.basebackup_cxt.buf_block, pad);
     }
 
     (void)FreeFile(fp);
@@ -1804,7 +1819,47 @@ static void _tarWriteHeader(const char *filename, const char *linktarget, struct
 
     /* Link tag 100 (NULL) */
     /* Now send the completed header. */
-    (void)pq_putmessage_noblock('d', h, BUILD_PATH_LEN);
+    (void)SendTarData(h, BUILD_PATH_LEN);
+}
+
+/*
+ * Send a piece of the tar stream as one CopyData message.
+ *
+ * With the COMPRESS option every message is LZ4 compressed on its own, so the
+ * client sees the same message boundaries after decompression. The payload is
+ * the uncompressed length as a 4 byte network order integer, followed by the
+ * compressed data, or by the raw data if it does not compress.
+ */
+static int SendTarData(const char *data, size_t len)
+{
+    if (!t_thrd.basebackup_cxt.compress || len == 0) {
+        return pq_putmessage_noblock('d', data, len);
+    }
+
+    int bound = LZ4_compressBound((int)len) + (int)sizeof(uint32);
+    if (t_thrd.basebackup_cxt.compress_buf_size < bound) {
+        MemoryContext oldcxt = MemoryContextSwitchTo(THREAD_GET_MEM_CXT_GROUP(MEMORY_CONTEXT_STORAGE));
+        if (t_thrd.basebackup_cxt.compress_buf != NULL) {
+            pfree(t_thrd.basebackup_cxt.compress_buf);
+        }
+        t_thrd.basebackup_cxt.compress_buf = (char *)palloc(bound);
+        t_thrd.basebackup_cxt.compress_buf_size = bound;
+        MemoryContextSwitchTo(oldcxt);
+    }
+
+    char *out = t_thrd.basebackup_cxt.compress_buf;
+    uint32 rawlen = htonl((uint32)len);
+    errno_t rc = memcpy_s(out, sizeof(uint32), &rawlen, sizeof(uint32));
+    securec_check(rc, "", "");
+
+    int outlen = LZ4_compress_default(data, out + sizeof(uint32), (int)len, bound - (int)sizeof(uint32));
+    if (outlen <= 0 || (size_t)outlen >= len) {
+        /* not compressible, the client tells this by the payload length */
+        rc = memcpy_s(out + sizeof(uint32), bound - sizeof(uint32), data, len);
+        securec_check(rc, "", "");
+        outlen = (int)len;
+    }
+    return pq_putmessage_noblock('d', out, sizeof(uint32) + outlen);
 }
 
 void ut_save_xlogloc(const char *xloglocation)
@@ -805,11 +805,12 @@ retry:
 
     /* Start streaming from the point requested by startup process */
     if (!t_thrd.walreceiver_cxt.AmWalReceiverForFailover && slotname != NULL)
-        nRet = snprintf_s(cmd, sizeof(cmd), sizeof(cmd) - 1, "START_REPLICATION SLOT \"%s\" %X/%X", slotname,
-                          (uint32)(*startpoint >> 32), (uint32)(*startpoint));
+        nRet = snprintf_s(cmd, sizeof(cmd), sizeof(cmd) - 1, "START_REPLICATION SLOT \"%s\" %X/%X%s", slotname,
+                          (uint32)(*startpoint >> 32), (uint32)(*startpoint),
+                          u_sess->attr.attr_storage.wal_receiver_compression ? " COMPRESS" : "");
     else
-        nRet = snprintf_s(cmd, sizeof(cmd), sizeof(cmd) - 1, "START_REPLICATION %X/%X", (uint32)(*startpoint >> 32),
-                          (uint32)(*startpoint));
+        nRet = snprintf_s(cmd, sizeof(cmd), sizeof(cmd) - 1, "START_REPLICATION %X/%X%s", (uint32)(*startpoint >> 32),
+                          (uint32)(*startpoint), u_sess->attr.attr_storage.wal_receiver_compression ? " COMPRESS" : "");
     securec_check_ss(nRet, "", "");
 
     res = libpqrcv_PQexec(cmd);
@@ -819,6 +820,8 @@ retry:
                                                                 PQerrorMessage(t_thrd.libwalreceiver_cxt.streamConn))));
     }
     PQclear(res);
+    /* a new stream, the sender starts compressing with an empty dictionary */
+    t_thrd.walreceiver_cxt.wal_decompress_dict_len = 0;
 
     ereport(LOG,
             (errmsg("streaming replication successfully connected to primary, the connection is %s, start from %X/%X ",
@@ -100,6 +100,13 @@ typedef struct ReorderBufferTupleCidEnt {
     CommandId combocid; /* just for debugging */
 } ReorderBufferTupleCidEnt;
 
+/* buffered reading of a spill file, refilled SPILL_READ_BUFFER_SIZE bytes at a time */
+typedef struct ReorderBufferSpillReader {
+    char *buf;
+    Size len; /* valid bytes in buf */
+    Size off; /* next byte to hand out */
+} ReorderBufferSpillReader;
+
 /* k-way in-order change iteration support structures */
 typedef struct ReorderBufferIterTXNEntry {
     XLogRecPtr lsn;
@@ -107,6 +114,7 @@ typedef struct ReorderBufferIterTXNEntry {
     ReorderBufferTXN *txn;
     int fd;
     XLogSegNo segno;
+    ReorderBufferSpillReader reader;
 } ReorderBufferIterTXNEntry;
 
 typedef struct ReorderBufferIterTXNState {
@@ -145,6 +153,16 @@ typedef struct ReorderBufferDiskChange {
 static const Size max_cached_changes = 4096 * 2;
 static const Size g_max_cached_transactions = 512;
 
+/*
+ * Spilled changes are written and read in chunks instead of one system call
+ * per change, restoring a large transaction at commit time is otherwise
+ * dominated by read() calls. There is a single write buffer per reorder
+ * buffer, but an iterator keeps a read buffer for each spilled (sub)transaction
+ * it merges, so those are kept small.
+ */
+#define SPILL_BUFFER_SIZE (BLCKSZ * 16)
+#define SPILL_READ_BUFFER_SIZE BLCKSZ
+
 /* ---------------------------------------
  * primary reorderbuffer support routines
  * ---------------------------------------
@@ -178,7 +196,10 @@ static void ReorderBufferExecuteInvalidations(ReorderBuffer *rb, ReorderBufferTX
 static void ReorderBufferCheckSerializeTXN(ReorderBuffer *rb, ReorderBufferTXN *txn);
 static void ReorderBufferSerializeTXN(ReorderBuffer *rb, ReorderBufferTXN *txn);
 static void ReorderBufferSerializeChange(ReorderBuffer *rb, ReorderBufferTXN *txn, int fd, ReorderBufferChange *change);
-static Size ReorderBufferRestoreChanges(ReorderBuffer *rb, ReorderBufferTXN *txn, int *fd, XLogSegNo *segno);
+static void ReorderBufferSpillFlush(ReorderBuffer *rb, ReorderBufferTXN *txn, int fd);
+static Size ReorderBufferRestoreChanges(ReorderBuffer *rb, ReorderBufferTXN *txn, int *fd, XLogSegNo *segno,
+                                        ReorderBufferSpillReader *reader);
+static Size ReorderBufferSpillRead(ReorderBuffer *rb, int fd, ReorderBufferSpillReader *reader, char *dest, Size len);
 static void ReorderBufferRestoreChange(ReorderBuffer *rb, ReorderBufferTXN *txn, char *change);
 static void ReorderBufferRestoreCleanup(ReorderBuffer *rb, ReorderBufferTXN *txn, XLogRecPtr lsn);
 
@@ -232,6 +253,8 @@ ReorderBuffer *ReorderBufferAllocate(void)
 
     buffer->outbuf = NULL;
     buffer->outbufsize = 0;
+    buffer->spillbuf = NULL;
+    buffer->spillbuflen = 0;
 
     buffer->current_restart_decoding_lsn = InvalidXLogRecPtr;
 
@@ -856,7 +879,8 @@ static ReorderBufferIterTXNState *ReorderBufferIterTXNInit(ReorderBuffer *rb, Re
         if (txn->serialized) {
             /* serialize remaining changes */
             ReorderBufferSerializeTXN(rb, txn);
-            (void)ReorderBufferRestoreChanges(rb, txn, &state->entries[off].fd, &state->entries[off].segno);
+            (void)ReorderBufferRestoreChanges(rb, txn, &state->entries[off].fd, &state->entries[off].segno,
+                                              &state->entries[off].reader);
         }
 
         cur_change = dlist_head_element(ReorderBufferChange, node, &txn->changes);
@@ -880,7 +904,8 @@ static ReorderBufferIterTXNState *ReorderBufferIterTXNInit(ReorderBuffer *rb, Re
             if (cur_txn->serialized) {
                 /* serialize remaining changes */
                 ReorderBufferSerializeTXN(rb, cur_txn);
-                (void)ReorderBufferRestoreChanges(rb, cur_txn, &state->entries[off].fd, &state->entries[off].segno);
+                (void)ReorderBufferRestoreChanges(rb, cur_txn, &state->entries[off].fd, &state->entries[off].segno,
+                                                  &state->entries[off].reader);
             }
 
             cur_change = dlist_head_element(ReorderBufferChange, node, &cur_txn->changes);
@@ -954,7 +979,7 @@ static ReorderBufferChange *ReorderBufferIterTXNNext(ReorderBuffer *rb, ReorderB
         dlist_delete(&change->node);
         dlist_push_tail(&state->old_change, &change->node);
 
-        if (ReorderBufferRestoreChanges(rb, entry->txn, &entry->fd, &state->entries[off].segno)) {
+        if (ReorderBufferRestoreChanges(rb, entry->txn, &entry->fd, &state->entries[off].segno, &entry->reader)) {
             /* successfully restored changes from disk */
             ReorderBufferChange *next_change = dlist_head_element(ReorderBufferChange, node, &entry->txn->changes);
 
@@ -989,6 +1014,9 @@ static void ReorderBufferIterTXNFinish(ReorderBuffer *rb, ReorderBufferIterTXNSt
         if (state->entries[off].fd != -1) {
             (void)CloseTransientFile(state->entries[off].fd);
         }
+        if (state->entries[off].reader.buf != NULL) {
+            pfree(state->entries[off].reader.buf);
+        }
     }
 
     /* free memory we might have "leaked" in the last *Next call */
@@ -1871,6 +1899,9 @@ static void ReorderBufferSerializeTXN(ReorderBuffer *rb, ReorderBufferTXN *txn)
         ReorderBufferSerializeTXN(rb, subtxn);
     }
 
+    /* drop anything left batched by a serialization that errored out */
+    rb->spillbuflen = 0;
+
     /* serialize changestream */
     dlist_foreach_modify(change_i, &txn->changes)
     {
@@ -1885,6 +1916,7 @@ static void ReorderBufferSerializeTXN(ReorderBuffer *rb, ReorderBufferTXN *txn)
             XLogRecPtr recptr;
 
             if (fd != -1) {
+                ReorderBufferSpillFlush(rb, txn, fd);
                 (void)CloseTransientFile(fd);
             }
             curOpenSegNo = (change->lsn) / XLogSegSize;
@@ -1919,6 +1951,7 @@ static void ReorderBufferSerializeTXN(ReorderBuffer *rb, ReorderBufferTXN *txn)
     txn->serialized = true;
 
     if (fd != -1) {
+        ReorderBufferSpillFlush(rb, txn, fd);
         (void)CloseTransientFile(fd);
     }
 }
@@ -2032,19 +2065,85 @@ static void ReorderBufferSerializeChange(ReorderBuffer *rb, ReorderBufferTXN *tx
     }
 
     ondisk->size = sz;
+    Assert(ondisk->change.action == change->action);
 
-    if ((Size)(write(fd, rb->outbuf, ondisk->size)) != ondisk->size) {
+    if (rb->spillbuflen + sz > SPILL_BUFFER_SIZE) {
+        ReorderBufferSpillFlush(rb, txn, fd);
+    }
+
+    if (sz > SPILL_BUFFER_SIZE) {
+        /* too large to batch, write it directly */
+        if ((Size)(write(fd, rb->outbuf, sz)) != sz) {
+            (void)CloseTransientFile(fd);
+            ereport(ERROR, (errcode_for_file_access(), errmsg("could not write to xid %lu's data file: %m", txn->xid)));
+        }
+        return;
+    }
+
+    if (rb->spillbuf == NULL) {
+        rb->spillbuf = (char *)MemoryContextAlloc(rb->context, SPILL_BUFFER_SIZE);
+    }
+    rc = memcpy_s(rb->spillbuf + rb->spillbuflen, SPILL_BUFFER_SIZE - rb->spillbuflen, rb->outbuf, sz);
+    securec_check(rc, "", "");
+    rb->spillbuflen += sz;
+}
+
+/*
+ * Write the changes batched by ReorderBufferSerializeChange to the spill file.
+ */
+static void ReorderBufferSpillFlush(ReorderBuffer *rb, ReorderBufferTXN *txn, int fd)
+{
+    if (rb->spillbuflen == 0) {
+        return;
+    }
+
+    Size len = rb->spillbuflen;
+    rb->spillbuflen = 0;
+    if ((Size)(write(fd, rb->spillbuf, len)) != len) {
         (void)CloseTransientFile(fd);
         ereport(ERROR, (errcode_for_file_access(), errmsg("could not write to xid %lu's data file: %m", txn->xid)));
     }
+}
 
-    Assert(ondisk->change.action == change->action);
+/*
+ * Copy the next len bytes of a spill file to dest through the reader's buffer.
+ * Returns the number of bytes copied, which is less than len only at the end
+ * of the file.
+ */
+static Size ReorderBufferSpillRead(ReorderBuffer *rb, int fd, ReorderBufferSpillReader *reader, char *dest, Size len)
+{
+    Size copied = 0;
+
+    while (copied < len) {
+        if (reader->off == reader->len) {
+            if (reader->buf == NULL) {
+                reader->buf = (char *)MemoryContextAlloc(rb->context, SPILL_READ_BUFFER_SIZE);
+            }
+            int readBytes = read(fd, reader->buf, SPILL_READ_BUFFER_SIZE);
+            if (readBytes < 0) {
+                ereport(ERROR, (errcode_for_file_access(), errmsg("could not read from reorderbuffer spill file: %m")));
+            }
+            reader->len = (Size)readBytes;
+            reader->off = 0;
+            if (readBytes == 0) {
+                break;
+            }
+        }
+
+        Size n = Min(len - copied, reader->len - reader->off);
+        errno_t rc = memcpy_s(dest + copied, len - copied, reader->buf + reader->off, n);
+        securec_check(rc, "", "");
+        reader->off += n;
+        copied += n;
+    }
+    return copied;
 }
 
 /*
  * Restore a number of changes spilled to disk back into memory.
  */
-static Size ReorderBufferRestoreChanges(ReorderBuffer *rb, ReorderBufferTXN *txn, int *fd, XLogSegNo *segno)
+static Size ReorderBufferRestoreChanges(ReorderBuffer *rb, ReorderBufferTXN *txn, int *fd, XLogSegNo *segno,
+                                        ReorderBufferSpillReader *reader)
 {
     Size restored = 0;
     XLogSegNo last_segno;
@@ -2092,6 +2191,7 @@ static Size ReorderBufferRestoreChanges(ReorderBuffer *rb, ReorderBufferTXN *txn
                            (uint32)recptr);
             securec_check_ss(rc, "", "");
             *fd = OpenTransientFile(path, O_RDONLY | PG_BINARY, 0);
+            reader->len = reader->off = 0;
             if (*fd < 0 && errno == ENOENT) {
                 *fd = -1;
                 (*segno)++;
@@ -2106,15 +2206,13 @@ static Size ReorderBufferRestoreChanges(ReorderBuffer *rb, ReorderBufferTXN *txn
          * end of this file.
          */
         ReorderBufferSerializeReserve(rb, sizeof(ReorderBufferDiskChange));
-        readBytes = read(*fd, rb->outbuf, sizeof(ReorderBufferDiskChange));
+        readBytes = (int)ReorderBufferSpillRead(rb, *fd, reader, rb->outbuf, sizeof(ReorderBufferDiskChange));
         /* eof */
         if (readBytes == 0) {
             (void)CloseTransientFile(*fd);
             *fd = -1;
             (*segno)++;
             continue;
-        } else if (readBytes < 0) {
-            ereport(ERROR, (errcode_for_file_access(), errmsg("could not read from reorderbuffer spill file: %m")));
         } else if (readBytes != sizeof(ReorderBufferDiskChange)) {
             ereport(ERROR, (errcode_for_file_access(),
                             errmsg("incomplete read from reorderbuffer spill file: read %d instead of %u", readBytes,
@@ -2129,11 +2227,9 @@ static Size ReorderBufferRestoreChanges(ReorderBuffer *rb, ReorderBufferTXN *txn
             ereport(ERROR, (errcode_for_file_access(),
                             errmsg("illegality read length %lu", (ondisk->size - sizeof(ReorderBufferDiskChange)))));
         }
-        readBytes = read(*fd, rb->outbuf + sizeof(ReorderBufferDiskChange),
-                         uint64(ondisk->size) - sizeof(ReorderBufferDiskChange));
-        if (readBytes < 0) {
-            ereport(ERROR, (errcode_for_file_access(), errmsg("could not read from reorderbuffer spill file: %m")));
-        } else if (INT2SIZET(readBytes) != ondisk->size - sizeof(ReorderBufferDiskChange)) {
+        readBytes = (int)ReorderBufferSpillRead(rb, *fd, reader, rb->outbuf + sizeof(ReorderBufferDiskChange),
+                                                uint64(ondisk->size) - sizeof(ReorderBufferDiskChange));
+        if (INT2SIZET(readBytes) != ondisk->size - sizeof(ReorderBufferDiskChange)) {
             ereport(ERROR, (errcode_for_file_access(),
                             errmsg("could not read from reorderbuffer spill file: read %d instead of %u", readBytes,
                                    (uint32)(ondisk->size - sizeof(ReorderBufferDiskChange)))));
@@ -89,6 +89,7 @@
 %token K_NOWAIT
 %token K_WAL
 %token K_TABLESPACE_MAP
+%token K_COMPRESS
 %token K_DATA
 %token K_START_REPLICATION
 %token K_FETCH_MOT_CHECKPOINT
@@ -103,7 +104,7 @@
 %type <node>	base_backup start_replication start_data_replication fetch_mot_checkpoint start_logical_replication advance_logical_replication identify_system identify_version identify_mode identify_consistence create_replication_slot drop_replication_slot identify_maxlsn identify_channel identify_az
 %type <list>	base_backup_opt_list
 %type <defelt>	base_backup_opt
-%type <list>    plugin_options plugin_opt_list
+%type <list>    plugin_options plugin_opt_list opt_wal_compress
 %type <defelt>  plugin_opt_elem
 %type <node>    plugin_opt_arg
 %type <str>		opt_slot
@@ -218,7 +219,7 @@ identify_az:
 			;
 
 /*
- * BASE_BACKUP [LABEL '<label>'] [PROGRESS] [FAST] [WAL] [NOWAIT] [TABLESPACE_MAP]
+ * BASE_BACKUP [LABEL '<label>'] [PROGRESS] [FAST] [WAL] [NOWAIT] [TABLESPACE_MAP] [COMPRESS]
  */
 base_backup:
 			K_BASE_BACKUP base_backup_opt_list
@@ -263,14 +264,19 @@ base_backup_opt:
 					$$ = makeDefElem("tablespace_map",
 							(Node *)makeInteger(TRUE));
 				}
+			| K_COMPRESS
+				{
+					$$ = makeDefElem("compress",
+							(Node *)makeInteger(TRUE));
+				}
 			;
 
 /*
  * START_REPLICATION %X/%X
- * START_REPLICATION [SLOT slot] [PHYSICAL] %X/%X
+ * START_REPLICATION [SLOT slot] [PHYSICAL] %X/%X [COMPRESS]
  */
 start_replication:
-			K_START_REPLICATION opt_slot opt_physical RECPTR
+			K_START_REPLICATION opt_slot opt_physical RECPTR opt_wal_compress
 				{
 					StartReplicationCmd *cmd;
 
@@ -278,10 +284,20 @@ start_replication:
 					cmd->kind = REPLICATION_KIND_PHYSICAL;
  					cmd->slotname = $2;
  					cmd->startpoint = $4;
+					cmd->options = $5;
 
 					$$ = (Node *) cmd;
 				}
 			;
+
+opt_wal_compress:
+			K_COMPRESS
+				{
+					$$ = list_make1(makeDefElem("compress",
+							(Node *)makeInteger(TRUE)));
+				}
+			| /* EMPTY */					{ $$ = NIL; }
+			;
 			
 /*
  * START_REPLICATION DATA
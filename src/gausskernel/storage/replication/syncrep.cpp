@@ -527,6 +527,21 @@ void SyncRepReleaseWaiters(void)
         return;
     }
 
+    /*
+     * The released positions are computed from the sync standbys' positions,
+     * so if none of ours is beyond what is already released this reply cannot
+     * release anybody: skip the trip through SyncRepLock. Standbys that are
+     * ahead release the waiters when their own replies arrive. The released
+     * positions only move forward, so reading them without the lock is safe.
+     */
+    if (!t_thrd.syncrep_cxt.announce_next_takeover &&
+        XLByteLE(t_thrd.walsender_cxt.MyWalSnd->receive, walsndctl->lsn[SYNC_REP_WAIT_RECEIVE]) &&
+        XLByteLE(t_thrd.walsender_cxt.MyWalSnd->write, walsndctl->lsn[SYNC_REP_WAIT_WRITE]) &&
+        XLByteLE(t_thrd.walsender_cxt.MyWalSnd->flush, walsndctl->lsn[SYNC_REP_WAIT_FLUSH]) &&
+        XLByteLE(t_thrd.walsender_cxt.MyWalSnd->apply, walsndctl->lsn[SYNC_REP_WAIT_APPLY])) {
+        return;
+    }
+
     /*
      * We're a potential sync standby. Release waiters if we are the highest
      * priority standby. If there are multiple standbys with same priorities
@@ -572,20 +587,20 @@ void SyncRepReleaseWaiters(void)
      * this location.
      */
     if (XLByteLT(walsndctl->lsn[SYNC_REP_WAIT_RECEIVE], receivePtr)) {
-        walsndctl->lsn[SYNC_REP_WAIT_RECEIVE] = t_thrd.walsender_cxt.MyWalSnd->receive;
+        walsndctl->lsn[SYNC_REP_WAIT_RECEIVE] = receivePtr;
         numreceive = SyncRepWakeQueue(false, SYNC_REP_WAIT_RECEIVE);
     }
     if (XLByteLT(walsndctl->lsn[SYNC_REP_WAIT_WRITE], writePtr)) {
-        walsndctl->lsn[SYNC_REP_WAIT_WRITE] = t_thrd.walsender_cxt.MyWalSnd->write;
+        walsndctl->lsn[SYNC_REP_WAIT_WRITE] = writePtr;
         numwrite = SyncRepWakeQueue(false, SYNC_REP_WAIT_WRITE);
     }
     if (XLByteLT(walsndctl->lsn[SYNC_REP_WAIT_FLUSH], flushPtr)) {
-        walsndctl->lsn[SYNC_REP_WAIT_FLUSH] = t_thrd.walsender_cxt.MyWalSnd->flush;
+        walsndctl->lsn[SYNC_REP_WAIT_FLUSH] = flushPtr;
         numflush = SyncRepWakeQueue(false, SYNC_REP_WAIT_FLUSH);
     }
     if (XLByteLT(walsndctl->lsn[SYNC_REP_WAIT_APPLY], replayPtr)) {
-        walsndctl->lsn[SYNC_REP_WAIT_APPLY] = t_thrd.walsender_cxt.MyWalSnd->apply;
-        numflush = SyncRepWakeQueue(false, SYNC_REP_WAIT_APPLY);
+        walsndctl->lsn[SYNC_REP_WAIT_APPLY] = replayPtr;
+        numflush += SyncRepWakeQueue(false, SYNC_REP_WAIT_APPLY);
     }
 
     LWLockRelease(SyncRepLock);
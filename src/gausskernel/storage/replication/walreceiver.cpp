@@ -66,6 +66,7 @@
 #include "utils/guc.h"
 #include "utils/builtins.h"
 #include "utils/guc.h"
+#include "utils/memutils.h"
 #include "utils/ps_status.h"
 #include "utils/resowner.h"
 #include "utils/timestamp.h"
@@ -76,6 +77,7 @@
 #include "postmaster/postmaster.h"
 #include "hotpatch/hotpatch.h"
 #include "utils/distribute_test.h"
+#include "lz4.h"
 
 bool wal_catchup = false;
 
@@ -150,6 +152,7 @@ static void DisableWalRcvImmediateExit(void);
 static void WalRcvDie(int code, Datum arg);
 static void XLogWalRcvDataPageReplication(char *buf, Size len);
 static void XLogWalRcvProcessMsg(unsigned char type, char *buf, Size len);
+static char *XLogWalRcvDecompress(const char *buf, Size len, uint32 rawLen);
 static void XLogWalRcvReceive(char *buf, Size nbytes, XLogRecPtr recptr);
 static void XLogWalRcvReceiveInBuf(char *buf, Size nbytes, XLogRecPtr recptr);
 static void XLogWalRcvSendHSFeedback(void);
@@ -1016,6 +1019,33 @@ static void XLogWalRcvProcessMsg(unsigned char type, char *buf, Size len)
             }
             break;
         }
+        case 'z': /* compressed WAL records */
+        {
+            WalDataMessageHeader msghdr;
+            uint32 rawLen;
+            if (len < sizeof(WalDataMessageHeader) + sizeof(uint32))
+                ereport(ERROR, (errcode(ERRCODE_PROTOCOL_VIOLATION),
+                    errmsg_internal("invalid compressed WAL message received from primary")));
+            /* memcpy is required here for alignment reasons */
+            errorno = memcpy_s(&msghdr, sizeof(WalDataMessageHeader), buf, sizeof(WalDataMessageHeader));
+            securec_check(errorno, "", "");
+            errorno = memcpy_s(&rawLen, sizeof(uint32), buf + sizeof(WalDataMessageHeader), sizeof(uint32));
+            securec_check(errorno, "", "");
+
+            buf += sizeof(WalDataMessageHeader) + sizeof(uint32);
+            len -= sizeof(WalDataMessageHeader) + sizeof(uint32);
+            buf = XLogWalRcvDecompress(buf, len, rawLen);
+            len = rawLen;
+
+            ProcessWalHeaderMessage(&msghdr);
+
+            if (IsExtremeRedo()) {
+                XLogWalRcvReceiveInBuf(buf, len, msghdr.dataStart);
+            } else {
+                XLogWalRcvReceive(buf, len, msghdr.dataStart);
+            }
+            break;
+        }
         case 'd': /* Data page replication for the logical xlog */
         {
             XLogWalRcvDataPageReplication(buf, len);
@@ -1277,6 +1307,42 @@ inline void WalReceiverWaitCopyXLogCount(XLogRecPtr recptr, XLogRecPtr startptr,
                                   walreadoffset, (uint32)(startptr >> rightShiftSize), (uint32)startptr)));
     }
 }
+
+/*
+ * Decompress the WAL carried by a 'z' message. The result stays valid until
+ * the next compressed message is received.
+ */
+static char *XLogWalRcvDecompress(const char *buf, Size len, uint32 rawLen)
+{
+    MemoryContext cxt = THREAD_GET_MEM_CXT_GROUP(MEMORY_CONTEXT_STORAGE);
+
+    if (rawLen == 0 || rawLen > MaxAllocSize || len > INT_MAX)
+        ereport(ERROR, (errcode(ERRCODE_PROTOCOL_VIOLATION),
+            errmsg_internal("invalid compressed WAL message received from primary")));
+
+    if (t_thrd.walreceiver_cxt.wal_decompress_dict == NULL) {
+        t_thrd.walreceiver_cxt.wal_decompress_dict = (char *)MemoryContextAlloc(cxt, WAL_COMPRESS_DICT_SIZE);
+    }
+    if ((uint32)t_thrd.walreceiver_cxt.wal_decompress_buf_size < rawLen) {
+        if (t_thrd.walreceiver_cxt.wal_decompress_buf != NULL) {
+            pfree(t_thrd.walreceiver_cxt.wal_decompress_buf);
+        }
+        t_thrd.walreceiver_cxt.wal_decompress_buf = (char *)MemoryContextAlloc(cxt, rawLen);
+        t_thrd.walreceiver_cxt.wal_decompress_buf_size = (int)rawLen;
+    }
+
+    int decompressed = LZ4_decompress_safe_usingDict(buf, t_thrd.walreceiver_cxt.wal_decompress_buf, (int)len,
+                                                     (int)rawLen, t_thrd.walreceiver_cxt.wal_decompress_dict,
+                                                     t_thrd.walreceiver_cxt.wal_decompress_dict_len);
+    if (decompressed < 0 || (uint32)decompressed != rawLen)
+        ereport(ERROR, (errcode(ERRCODE_DATA_CORRUPTED),
+            errmsg_internal("could not decompress WAL message received from primary")));
+
+    WalCompressUpdateDict(t_thrd.walreceiver_cxt.wal_decompress_dict, &t_thrd.walreceiver_cxt.wal_decompress_dict_len,
+                          t_thrd.walreceiver_cxt.wal_decompress_buf, rawLen);
+    return t_thrd.walreceiver_cxt.wal_decompress_buf;
+}
+
 /*
  * Receive XLOG data into receiver buffer.
  */
@@ -101,6 +101,8 @@
 #include "alarm/alarm.h"
 #include "utils/distribute_test.h"
 #include "gs_bbox.h"
+#include "lz4.h"
+#include "portability/instr_time.h"
 
 #define CRC_LEN 11
 
@@ -204,6 +206,7 @@ static void WalSndWriteData(LogicalDecodingContext *ctx, XLogRecPtr lsn, Transac
 static XLogRecPtr WalSndWaitForWal(XLogRecPtr loc);
 
 static void XLogRead(char *buf, XLogRecPtr startptr, Size count);
+static bool WalSndSendCompressed(Size nbytes);
 
 static void SetWalSndPeerMode(ServerMode mode);
 static void SetWalSndPeerDbstate(DbState state);
@@ -1028,6 +1031,7 @@ static void IdentifyChannel(IdentifyChannelCmd *cmd)
 static void StartReplication(StartReplicationCmd *cmd)
 {
     StringInfoData buf;
+    ListCell *lc = NULL;
 
     /*
      * When promoting a cascading standby, postmaster sends SIGUSR2 to any
@@ -1081,6 +1085,17 @@ static void StartReplication(StartReplicationCmd *cmd)
      */
     WalSndSetState(WALSNDSTATE_CATCHUP);
 
+    /* the standby asks for a compressed stream, the dictionary starts out empty */
+    t_thrd.walsender_cxt.wal_compress = false;
+    t_thrd.walsender_cxt.wal_compress_dict_len = 0;
+    foreach (lc, cmd->options) {
+        DefElem *defel = (DefElem *)lfirst(lc);
+
+        if (strcmp(defel->defname, "compress") == 0) {
+            t_thrd.walsender_cxt.wal_compress = true;
+        }
+    }
+
     /* Send a CopyBothResponse message, and start streaming */
     pq_beginmessage(&buf, 'W');
     pq_sendbyte(&buf, 0);
@@ -2048,6 +2063,16 @@ static void ProcessRepliesIfAny(void)
         }
     }
 
+    /*
+     * A busy standby can have several replies queued up. Only the positions of
+     * the last one matter, so release the sync rep waiters once for all of them
+     * rather than taking SyncRepLock and scanning the wait queues per reply.
+     */
+    if (t_thrd.walsender_cxt.sync_release_pending) {
+        t_thrd.walsender_cxt.sync_release_pending = false;
+        SyncRepReleaseWaiters();
+    }
+
     /*
      * Save the last reply timestamp if we've received at least one reply.
      */
@@ -2370,8 +2395,9 @@ static void ProcessStandbyReplyMessage(void)
         }
     }
 
+    /* released once all the replies available have been read, see ProcessRepliesIfAny */
     if (!AM_WAL_STANDBY_SENDER) {
-        SyncRepReleaseWaiters();
+        t_thrd.walsender_cxt.sync_release_pending = true;
     }
 
     /*
@@ -3837,6 +3863,12 @@ static void WalSndKill(int code, Datum arg)
         bbox_blacklist_remove(XLOG_MESSAGE_SEND, t_thrd.walsender_cxt.output_xlog_message);
     }
 
+    if (t_thrd.walsender_cxt.wal_compress_sent_bytes > 0) {
+        ereport(LOG, (errmsg("WAL stream compression: %lu bytes of WAL sent as %lu bytes, compression took %lu ms",
+                             t_thrd.walsender_cxt.wal_compress_raw_bytes, t_thrd.walsender_cxt.wal_compress_sent_bytes,
+                             t_thrd.walsender_cxt.wal_compress_time_us / 1000)));
+    }
+
     ereport(LOG, (errmsg("walsender thread shut down")));
 }
 
@@ -4189,8 +4221,10 @@ static void XLogSendPhysical(void)
                        sizeof(WalDataMessageHeader) + g_instance.attr.attr_storage.MaxSendSize * 1024, &msghdr,
                        sizeof(WalDataMessageHeader));
     securec_check(errorno, "\0", "\0");
-    (void)pq_putmessage_noblock('d', t_thrd.walsender_cxt.output_xlog_message,
-                                1 + sizeof(WalDataMessageHeader) + nbytes);
+    if (!t_thrd.walsender_cxt.wal_compress || nbytes == 0 || !WalSndSendCompressed(nbytes)) {
+        (void)pq_putmessage_noblock('d', t_thrd.walsender_cxt.output_xlog_message,
+                                    1 + sizeof(WalDataMessageHeader) + nbytes);
+    }
 
     t_thrd.walsender_cxt.sentPtr = endptr;
 
@@ -4210,8 +4244,15 @@ static void XLogSendPhysical(void)
         char activitymsg[50];
         int rc = 0;
 
-        rc = snprintf_s(activitymsg, sizeof(activitymsg), sizeof(activitymsg) - 1, "streaming %X/%X",
-                        (uint32)(t_thrd.walsender_cxt.sentPtr >> 32), (uint32)t_thrd.walsender_cxt.sentPtr);
+        if (t_thrd.walsender_cxt.wal_compress_sent_bytes > 0) {
+            rc = snprintf_s(activitymsg, sizeof(activitymsg), sizeof(activitymsg) - 1, "streaming %X/%X ratio %.2f",
+                            (uint32)(t_thrd.walsender_cxt.sentPtr >> 32), (uint32)t_thrd.walsender_cxt.sentPtr,
+                            (double)t_thrd.walsender_cxt.wal_compress_raw_bytes /
+                                t_thrd.walsender_cxt.wal_compress_sent_bytes);
+        } else {
+            rc = snprintf_s(activitymsg, sizeof(activitymsg), sizeof(activitymsg) - 1, "streaming %X/%X",
+                            (uint32)(t_thrd.walsender_cxt.sentPtr >> 32), (uint32)t_thrd.walsender_cxt.sentPtr);
+        }
         securec_check_ss(rc, "\0", "\0");
 
         set_ps_display(activitymsg, false);
@@ -4220,6 +4261,88 @@ static void XLogSendPhysical(void)
     return;
 }
 
+/*
+ * Send the WAL slice prepared in output_xlog_message as a compressed 'z'
+ * message. Returns false without sending anything if the slice does not
+ * compress, the caller then sends it as a plain 'w' message.
+ */
+static bool WalSndSendCompressed(Size nbytes)
+{
+    const Size prefixLen = 1 + sizeof(WalDataMessageHeader) + sizeof(uint32);
+    char *raw = t_thrd.walsender_cxt.output_xlog_message + 1 + sizeof(WalDataMessageHeader);
+    uint32 rawLen = (uint32)nbytes;
+    MemoryContext cxt = THREAD_GET_MEM_CXT_GROUP(MEMORY_CONTEXT_STORAGE);
+    instr_time startTime;
+    instr_time duration;
+    errno_t rc = EOK;
+
+    if (t_thrd.walsender_cxt.wal_compress_stream == NULL) {
+        t_thrd.walsender_cxt.wal_compress_stream = MemoryContextAllocZero(cxt, sizeof(LZ4_stream_t));
+        t_thrd.walsender_cxt.wal_compress_dict = (char *)MemoryContextAlloc(cxt, WAL_COMPRESS_DICT_SIZE);
+    }
+    if ((Size)t_thrd.walsender_cxt.wal_compress_buf_size < prefixLen + nbytes) {
+        if (t_thrd.walsender_cxt.wal_compress_buf != NULL) {
+            pfree(t_thrd.walsender_cxt.wal_compress_buf);
+        }
+        t_thrd.walsender_cxt.wal_compress_buf_size = (int)(prefixLen + g_instance.attr.attr_storage.MaxSendSize * 1024);
+        t_thrd.walsender_cxt.wal_compress_buf =
+            (char *)MemoryContextAlloc(cxt, t_thrd.walsender_cxt.wal_compress_buf_size);
+    }
+
+    INSTR_TIME_SET_CURRENT(startTime);
+    LZ4_stream_t *stream = (LZ4_stream_t *)t_thrd.walsender_cxt.wal_compress_stream;
+    (void)LZ4_loadDict(stream, t_thrd.walsender_cxt.wal_compress_dict, t_thrd.walsender_cxt.wal_compress_dict_len);
+    /* leave no room for output that is not smaller than the input */
+    int compressedLen = LZ4_compress_fast_continue(stream, raw, t_thrd.walsender_cxt.wal_compress_buf + prefixLen,
+                                                   (int)nbytes, (int)nbytes - 1, 1);
+    INSTR_TIME_SET_CURRENT(duration);
+    INSTR_TIME_SUBTRACT(duration, startTime);
+    t_thrd.walsender_cxt.wal_compress_time_us += INSTR_TIME_GET_MICROSEC(duration);
+    if (compressedLen <= 0) {
+        return false;
+    }
+
+    t_thrd.walsender_cxt.wal_compress_buf[0] = 'z';
+    rc = memcpy_s(t_thrd.walsender_cxt.wal_compress_buf + 1, sizeof(WalDataMessageHeader),
+                  t_thrd.walsender_cxt.output_xlog_message + 1, sizeof(WalDataMessageHeader));
+    securec_check(rc, "\0", "\0");
+    rc = memcpy_s(t_thrd.walsender_cxt.wal_compress_buf + 1 + sizeof(WalDataMessageHeader), sizeof(uint32), &rawLen,
+                  sizeof(uint32));
+    securec_check(rc, "\0", "\0");
+    (void)pq_putmessage_noblock('d', t_thrd.walsender_cxt.wal_compress_buf, prefixLen + compressedLen);
+
+    WalCompressUpdateDict(t_thrd.walsender_cxt.wal_compress_dict, &t_thrd.walsender_cxt.wal_compress_dict_len, raw,
+                          nbytes);
+    t_thrd.walsender_cxt.wal_compress_raw_bytes += nbytes;
+    t_thrd.walsender_cxt.wal_compress_sent_bytes += prefixLen + compressedLen;
+    return true;
+}
+
+/*
+ * Slide the WAL stream compression dictionary window over the WAL just sent or
+ * received in a 'z' message. Sender and receiver must apply the same updates.
+ */
+void WalCompressUpdateDict(char *dict, int *dictLen, const char *data, Size len)
+{
+    errno_t rc = EOK;
+
+    if (len >= WAL_COMPRESS_DICT_SIZE) {
+        rc = memcpy_s(dict, WAL_COMPRESS_DICT_SIZE, data + len - WAL_COMPRESS_DICT_SIZE, WAL_COMPRESS_DICT_SIZE);
+        securec_check(rc, "\0", "\0");
+        *dictLen = WAL_COMPRESS_DICT_SIZE;
+        return;
+    }
+
+    int keep = Min(*dictLen, WAL_COMPRESS_DICT_SIZE - (int)len);
+    if (keep > 0 && keep < *dictLen) {
+        rc = memmove_s(dict, WAL_COMPRESS_DICT_SIZE, dict + *dictLen - keep, keep);
+        securec_check(rc, "\0", "\0");
+    }
+    rc = memcpy_s(dict + keep, WAL_COMPRESS_DICT_SIZE - keep, data, len);
+    securec_check(rc, "\0", "\0");
+    *dictLen = keep + (int)len;
+}
+
 /*
  * Request walsenders to reload the currently-open WAL file
  */
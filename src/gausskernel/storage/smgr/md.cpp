@@ -640,16 +640,30 @@ void mdclose(SMgrRelation reln, ForkNumber forknum)
 /*
  *	mdprefetch() -- Initiate asynchronous read of the specified block of a relation
  *      Currently, don't prefetch a bucket dir.
+ *
+ * Prefetching is only a hint, so a missing file or segment is silently ignored
+ * and no segment is ever created here, even during recovery where the redo
+ * dispatcher prefetches blocks of relations that may be dropped later on.
  */
 void mdprefetch(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum)
 {
 #ifdef USE_PREFETCH
     off_t seekpos;
     MdfdVec *v = NULL;
+    BlockNumber targetseg = blocknum / ((BlockNumber)RELSEG_SIZE);
 
     Assert(reln->smgr_rnode.node.bucketNode != DIR_BUCKET_ID);
 
-    v = _mdfd_getseg(reln, forknum, blocknum, false, EXTENSION_FAIL);
+    v = mdopen(reln, forknum, EXTENSION_RETURN_NULL);
+    for (BlockNumber nextsegno = 1; v != NULL && nextsegno <= targetseg; nextsegno++) {
+        if (v->mdfd_chain == NULL) {
+            v->mdfd_chain = _mdfd_openseg(reln, forknum, nextsegno, 0);
+        }
+        v = v->mdfd_chain;
+    }
+    if (v == NULL) {
+        return;
+    }
 
     seekpos = (off_t)BLCKSZ * (blocknum % ((BlockNumber)RELSEG_SIZE));
 
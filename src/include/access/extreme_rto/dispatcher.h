@@ -33,6 +33,7 @@
 #include "access/xlogreader.h"
 #include "nodes/pg_list.h"
 #include "storage/proc.h"
+#include "storage/smgr.h"
 #include "access/redo_statistic.h"
 #include "access/extreme_rto/redo_item.h"
 #include "access/extreme_rto/page_redo.h"
@@ -162,6 +163,8 @@ typedef struct {
     bool needImmediateCheckpoint;
     bool needFullSyncCheckpoint;
     volatile sig_atomic_t smartShutdown;
+    SMgrRelation prefetchReln;  /* relation of the last prefetched block, see PrefetchRecordBlocks */
+    uint64 prefetchBlockCount; /* number of blocks prefetched ahead of page redo */
 #ifdef USE_ASSERT_CHECKING
     void *originLsnCheckAddr;
     LsnCheckCtl *lsnCheckCtl;
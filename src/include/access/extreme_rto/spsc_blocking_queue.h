@@ -52,6 +52,7 @@ bool SPSCBlockingQueuePut(SPSCBlockingQueue *queue, void *element);
 void *SPSCBlockingQueueTake(SPSCBlockingQueue *queue);
 bool SPSCBlockingQueueIsEmpty(SPSCBlockingQueue *queue);
 void *SPSCBlockingQueueTop(SPSCBlockingQueue *queue);
+void *SPSCBlockingQueuePeek(SPSCBlockingQueue *queue, uint32 n);
 void SPSCBlockingQueuePop(SPSCBlockingQueue *queue);
 void DumpQueue(const SPSCBlockingQueue *queue);
 uint32 SPSCGetQueueCount(SPSCBlockingQueue *queue);
@@ -21,6 +21,8 @@
 #include "access/tupdesc.h"
 
 #define PARALLEL_SCAN_GAP 100
+/* blocks handed out at a time by a shared parallel scan cursor */
+#define PARALLEL_SCAN_MORSEL 32
 
 /* ----------------------------------------------------------------
  *				 Scan State Information
@@ -42,6 +44,8 @@ typedef struct HeapScanDescData {
     /* these fields only used in page-at-a-time mode and for bitmap scans */
     int rs_mindex;                                   /* marked tuple's saved index */
     int dop;                                         /* scan parallel degree */
+    volatile uint32* rs_morsel_cursor;               /* shared morsel cursor of a parallel scan, if any */
+    BlockNumber rs_morsel_end;                       /* end of the morsel being scanned */
     /* put decompressed tuple data into rs_ctbuf be careful  , when malloc memory  should give extra mem for
      *xs_ctbuf_hdr. t_bits which is varlength arr
      */
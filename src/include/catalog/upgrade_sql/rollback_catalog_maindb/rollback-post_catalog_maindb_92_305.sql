@@ -0,0 +1,124 @@
+--------------------------------------------------------------
+-- remove p99_elapse_time and p999_elapse_time from the unique sql views
+--------------------------------------------------------------
+DO $DO$
+DECLARE
+ans boolean;
+BEGIN
+  select case when count(*)=1 then true else false end as ans from (select nspname from pg_namespace where nspname='dbe_perf' limit 1) into ans;
+  if ans = true then
+    DROP VIEW IF EXISTS DBE_PERF.summary_statement cascade;
+    DROP FUNCTION IF EXISTS DBE_PERF.get_summary_statement() cascade;
+    DROP VIEW IF EXISTS DBE_PERF.statement cascade;
+  end if;
+END$DO$;
+
+DROP FUNCTION IF EXISTS pg_catalog.get_instr_unique_sql() cascade;
+
+SET LOCAL inplace_upgrade_next_system_object_oids = IUO_PROC, 5702;
+CREATE FUNCTION pg_catalog.get_instr_unique_sql
+(
+    OUT node_name name,
+    OUT node_id integer,
+    OUT user_name name,
+    OUT user_id oid,
+    OUT unique_sql_id bigint,
+    OUT query text,
+    OUT n_calls bigint,
+    OUT min_elapse_time bigint,
+    OUT max_elapse_time bigint,
+    OUT total_elapse_time bigint,
+    OUT n_returned_rows bigint,
+    OUT n_tuples_fetched bigint,
+    OUT n_tuples_returned bigint,
+    OUT n_tuples_inserted bigint,
+    OUT n_tuples_updated bigint,
+    OUT n_tuples_deleted bigint,
+    OUT n_blocks_fetched bigint,
+    OUT n_blocks_hit bigint,
+    OUT n_soft_parse bigint,
+    OUT n_hard_parse bigint,
+    OUT db_time bigint,
+    OUT cpu_time bigint,
+    OUT execution_time bigint,
+    OUT parse_time bigint,
+    OUT plan_time bigint,
+    OUT rewrite_time bigint,
+    OUT pl_execution_time bigint,
+    OUT pl_compilation_time bigint,
+    OUT data_io_time bigint,
+    OUT net_send_info text,
+    OUT net_recv_info text,
+    OUT net_stream_send_info text,
+    OUT net_stream_recv_info text,
+    OUT last_updated timestamp with time zone,
+    OUT sort_count bigint,
+    OUT sort_time bigint,
+    OUT sort_mem_used bigint,
+    OUT sort_spill_count bigint,
+    OUT sort_spill_size bigint,
+    OUT hash_count bigint,
+    OUT hash_time bigint,
+    OUT hash_mem_used bigint,
+    OUT hash_spill_count bigint,
+    OUT hash_spill_size bigint
+)
+RETURNS setof record LANGUAGE INTERNAL VOLATILE NOT FENCED as 'get_instr_unique_sql';
+
+DO $DO$
+DECLARE
+  ans boolean;
+  user_name text;
+  query_str text;
+BEGIN
+  select case when count(*)=1 then true else false end as ans from (select nspname from pg_namespace where nspname='dbe_perf' limit 1) into ans;
+  if ans = true then
+    CREATE VIEW DBE_PERF.statement AS
+      SELECT * FROM get_instr_unique_sql();
+
+    CREATE OR REPLACE FUNCTION dbe_perf.get_summary_statement()
+    RETURNS setof dbe_perf.statement
+    AS $$
+    DECLARE
+      row_data dbe_perf.statement%rowtype;
+      row_name record;
+      query_str text;
+      query_str_nodes text;
+      BEGIN
+        --Get all the node names
+        query_str_nodes := 'select * from dbe_perf.node_name';
+        FOR row_name IN EXECUTE(query_str_nodes) LOOP
+          query_str := 'SELECT * FROM dbe_perf.statement';
+            FOR row_data IN EXECUTE(query_str) LOOP
+              return next row_data;
+           END LOOP;
+        END LOOP;
+        return;
+      END; $$
+    LANGUAGE 'plpgsql' NOT FENCED;
+
+    CREATE VIEW DBE_PERF.summary_statement AS
+      SELECT * FROM DBE_PERF.get_summary_statement();
+
+    SELECT SESSION_USER INTO user_name;
+    query_str := 'GRANT ALL ON TABLE DBE_PERF.STATEMENT TO ' || quote_ident(user_name) || ';';
+    EXECUTE IMMEDIATE query_str;
+    query_str := 'GRANT ALL ON TABLE DBE_PERF.summary_statement TO ' || quote_ident(user_name) || ';';
+    EXECUTE IMMEDIATE query_str;
+
+    GRANT SELECT ON TABLE DBE_PERF.STATEMENT TO PUBLIC;
+    GRANT SELECT ON TABLE DBE_PERF.summary_statement TO PUBLIC;
+  end if;
+END$DO$;
+
+DO $DO$
+DECLARE
+ans boolean;
+BEGIN
+  select case when count(*)=1 then true else false end as ans from (select * from pg_tables where tablename = 'snap_summary_statement' and schemaname = 'snapshot' limit 1) into ans;
+  if ans = true then
+    alter table snapshot.snap_summary_statement
+    DROP COLUMN IF EXISTS snap_p99_elapse_time,
+    DROP COLUMN IF EXISTS snap_p999_elapse_time;
+  end if;
+END$DO$;
@@ -0,0 +1,4 @@
+--------------------------------------------------------------
+-- remove get_local_operator_profile
+--------------------------------------------------------------
+DROP FUNCTION IF EXISTS pg_catalog.get_local_operator_profile() CASCADE;
@@ -0,0 +1,35 @@
+--------------------------------------------------------------
+-- add hit_count and plan_time to plancache_status
+--------------------------------------------------------------
+DROP FUNCTION IF EXISTS pg_catalog.plancache_status() CASCADE;
+
+SET LOCAL inplace_upgrade_next_system_object_oids = IUO_PROC, 3957;
+CREATE OR REPLACE FUNCTION pg_catalog.plancache_status(
+    OUT nodename text,
+    OUT query text,
+    OUT refcount int4,
+    OUT valid bool,
+    OUT DatabaseID oid,
+    OUT schema_name text,
+    OUT params_num int4,
+    OUT func_id oid,
+    OUT hit_count int8,
+    OUT plan_time float8)
+RETURNS SETOF RECORD LANGUAGE INTERNAL AS 'gs_globalplancache_status';
+
+DO $DO$
+DECLARE
+ans boolean;
+BEGIN
+  select case when count(*)=1 then true else false end as ans from (select nspname from pg_namespace where nspname='dbe_perf' limit 1) into ans;
+  if ans = true then
+    DROP VIEW IF EXISTS DBE_PERF.local_plancache_status CASCADE;
+    DROP VIEW IF EXISTS DBE_PERF.global_plancache_status CASCADE;
+
+    CREATE VIEW DBE_PERF.local_plancache_status AS
+      SELECT * FROM pg_catalog.plancache_status();
+
+    CREATE VIEW DBE_PERF.global_plancache_status AS
+      SELECT * FROM pg_catalog.plancache_status();
+  end if;
+END$DO$;
@@ -0,0 +1,14 @@
+--------------------------------------------------------------
+-- add get_local_operator_profile
+--------------------------------------------------------------
+DROP FUNCTION IF EXISTS pg_catalog.get_local_operator_profile() CASCADE;
+
+SET LOCAL inplace_upgrade_next_system_object_oids = IUO_PROC, 5725;
+CREATE OR REPLACE FUNCTION pg_catalog.get_local_operator_profile(
+    OUT unique_query_id int8,
+    OUT user_id oid,
+    OUT cn_id int4,
+    OUT plan_node_id int4,
+    OUT samples int8,
+    OUT cpu_samples int8)
+RETURNS SETOF RECORD LANGUAGE INTERNAL VOLATILE NOT FENCED AS 'get_local_operator_profile';
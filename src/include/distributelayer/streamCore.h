@@ -145,10 +145,25 @@ typedef struct TupleVector {
     int tuplePointer;
 } TupleVector;
 
+/* Number of batches or tuple vectors buffered between one local producer and one local consumer. */
+#define LOCAL_STREAM_RING_SIZE 4
+
+/*
+ * Single producer single consumer ring of data slots for local stream. The producer fills
+ * the slot at head and publishes it by advancing head; the consumer takes the slot at tail
+ * and releases it by advancing tail. Vector batches are handed over by swapping them with
+ * the consumer's current batch, so all of them live in localStreamMemoryCtx.
+ */
+typedef struct LocalStreamRing {
+    volatile uint32 head;
+    volatile uint32 tail;
+    VectorBatch* batches[LOCAL_STREAM_RING_SIZE];
+    TupleVector* tuples[LOCAL_STREAM_RING_SIZE];
+} LocalStreamRing;
+
 typedef struct StreamSharedContext {
     MemoryContext localStreamMemoryCtx; /**/
-    VectorBatch*** sharedBatches;
-    TupleVector*** sharedTuples;
+    LocalStreamRing** rings;
     StringInfo** messages;
     DataStatus** dataStatus;
     bool** is_connect_end;
@@ -280,6 +295,19 @@ public:
     static pthread_mutex_t m_streamInfoLock;
 };
 
+typedef struct ParallelScanCursorKey {
+    int plan_node_id;
+    Oid relid;
+    int scan_no;
+} ParallelScanCursorKey;
+
+/* Shared morsel cursor of a parallel seq scan, see GetParallelScanCursor(). */
+typedef struct ParallelScanCursor {
+    ParallelScanCursorKey key;
+    int pending_workers; /* workers that have not released the cursor yet */
+    volatile uint32 next_morsel;
+} ParallelScanCursor;
+
 /* Stream node group is book keeper for stream object. */
 class StreamNodeGroup : public BaseObject {
 public:
@@ -377,6 +405,9 @@ public:
     /* Controller list for recursive */
     List* m_syncControllers;
 
+    /* Morsel cursors of parallel seq scans, created on first use */
+    HTAB* m_scanCursors;
+
     MemoryContext m_streamRuntimeContext;
 
     /* Save the first error data of producer thread */
@@ -400,6 +431,8 @@ public:
     void AddSyncController(SyncController* controller);
     SyncController* GetSyncController(int controller_plannodeid);
     void MarkSyncControllerStopFlagAll();
+    volatile uint32* GetParallelScanCursor(int plannodeid, Oid relid, int scan_no, int dop);
+    void ReleaseParallelScanCursor(int plannodeid, Oid relid, int scan_no);
 
     inline pthread_mutex_t* GetStreamMutext()
     {
@@ -488,7 +521,7 @@ private:
     /* Mark if VFD of recursive is invalid. */
     bool m_recursiveVfdInvalid;
 
-    /* Mutex for sync controller and vfd operation. */
+    /* Mutex for sync controller, scan cursor and vfd operation. */
     pthread_mutex_t m_recursiveMutex;
 
     /* Global context stream object using. */
@@ -149,6 +149,12 @@ public:
     /* Copy the batch/tuple to shared memory. */
     void sendByMemory(TupleTableSlot* tuple, VectorBatch* batchSrc, int nthChannel, int nthRow = -1);
 
+    /* Copy the given rows of the batch to shared memory. */
+    void sendRowsByMemory(VectorBatch* batchSrc, int nthChannel, const int* rows, int nrows);
+
+    /* Stop the executor if all local consumers are closed. */
+    void checkLocalConsumerEnd();
+
     /* Mark local stream as finished. */
     void finalizeLocalStream();
 
@@ -483,6 +489,10 @@ private:
 
     int m_locator[BatchMaxSize];
 
+    /* Rows of the batch grouped by local channel, and the start of each channel in it. */
+    int m_localRows[BatchMaxSize];
+    int* m_localRowStart;
+
     /* The send dest for local stream to send error message. */
     int m_nth;
 
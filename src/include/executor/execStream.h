@@ -134,6 +134,8 @@ extern bool ScanMemoryStream(StreamState* node);
 extern bool gs_memory_recv(StreamState* node);
 extern void gs_memory_send(
     TupleTableSlot* tuple, VectorBatch* batchsrc, StreamSharedContext* sharedContext, int nthChannel, int nthRow);
+extern void gs_memory_send_rows(
+    VectorBatch* batchsrc, StreamSharedContext* sharedContext, int nthChannel, const int* rows, int nrows);
 extern void gs_memory_disconnect(StreamSharedContext* sharedContext, int nthChannel);
 extern void gs_message_by_memory(StringInfo buf, StreamSharedContext* sharedContext, int nthChannel);
 extern void gs_memory_send_finish(StreamSharedContext* sharedContext, int connNum);
@@ -122,6 +122,9 @@ typedef struct HashJoinTableData {
     int nbuckets;      /* # buckets in the in-memory hash table */
     int log2_nbuckets; /* its log2 (nbuckets must be a power of 2) */
 
+    int nbuckets_optimal;      /* optimal # buckets for the tuples seen so far */
+    int log2_nbuckets_optimal; /* its log2 */
+
     /* buckets[i] is head of list of tuples in i'th in-memory bucket */
     struct HashJoinTupleData** buckets;
     /* buckets array is per-batch storage, as are all the tuples */
@@ -180,6 +183,7 @@ typedef struct HashJoinTableData {
     int spreadNum;          /* auto spread times */
     int64* spill_size;
     uint64 spill_count;     /* times of spilling to disk */
+    int64 sysBusyCheckSpace; /* spaceUsed when system memory was last checked */
 } HashJoinTableData;
 
 #endif /* HASHJOIN_H */
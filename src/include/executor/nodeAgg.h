@@ -59,6 +59,12 @@ typedef struct AggWriteFileControl {
     int curfile;
     int64 maxMem;  /* mem spread memory, in bytes */
     int spreadNum; /* dynamic spread time */
+    int hashshift; /* hash value bits already used to partition filesource */
+    bool respill;  /* current temp file does not fit in memory, new groups go to overflowsource */
+    hashFileSource* overflowsource; /* temp files for groups respilled from filesource */
+    int overflowfilenum;
+    int overflowshift; /* hash value bits used to partition overflowsource */
+    int spillTimes;
 } AggWriteFileControl;
 
 /*
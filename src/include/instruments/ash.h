@@ -59,6 +59,7 @@ typedef struct SessionHistEntry {
     int waitnode_count;              /* count of waiting nodes */
     int nodeid;                      /* maybe for nodeoid/nodeidx */
     int plannodeid;                  /* indentify which consumer is receiving data for SCTP */
+    int exec_plannodeid;             /* plan node being executed when sampled, -1 if none */
     char* relname;                   /* relation name, for analyze, vacuum, .etc.*/
     Oid libpq_wait_nodeid;           /* for libpq, point to libpq_wait_node*/
     int libpq_wait_nodecount;        /* for libpq, point to libpq_wait_nodecount*/
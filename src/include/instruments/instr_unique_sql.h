@@ -30,6 +30,7 @@
 #include "nodes/parsenodes.h"
 #include "pgstat.h"
 #include "instruments/unique_sql_basic.h"
+#include "instruments/latency_sketch.h"
 #include "utils/batchsort.h"
 
 typedef struct {
@@ -62,6 +63,7 @@ typedef struct {
 
     pg_atomic_uint64 calls;          /* calling times */
     UniqueSQLElapseTime elapse_time; /* elapst time stat in ms */
+    LatencySketch elapse_sketch;     /* elapse time distribution, for quantiles */
     TimestampTz updated_time;        /* latest update time for the unique sql entry */
     UniqueSQLTime timeInfo;
     UniqueSQLNetInfo netInfo;
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020 Huawei Technologies Co.,Ltd.
+ *
+ * openGauss is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *          http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * ---------------------------------------------------------------------------------------
+ *
+ * latency_sketch.h
+ *     Mergeable quantile sketch for response times.
+ *
+ * Values (in microseconds) are counted in log-linear buckets: every power of
+ * two is split into LATENCY_SKETCH_SUB_BUCKETS equal buckets, so any quantile
+ * is reported within about 6% of the real value. Updates are a single atomic
+ * increment, and two sketches are merged by adding their buckets.
+ *
+ * IDENTIFICATION
+ *        src/include/instruments/latency_sketch.h
+ *
+ * ---------------------------------------------------------------------------------------
+ */
+
+#ifndef LATENCY_SKETCH_H
+#define LATENCY_SKETCH_H
+
+#include "utils/atomic.h"
+
+#define LATENCY_SKETCH_SUB_BITS 3
+#define LATENCY_SKETCH_SUB_BUCKETS (1 << LATENCY_SKETCH_SUB_BITS)
+/* values from 2^40 us (about 12 days) on share the last bucket */
+#define LATENCY_SKETCH_MAX_EXP 40
+#define LATENCY_SKETCH_BUCKETS ((LATENCY_SKETCH_MAX_EXP - LATENCY_SKETCH_SUB_BITS + 2) * LATENCY_SKETCH_SUB_BUCKETS)
+
+typedef struct LatencySketch {
+    pg_atomic_uint32 counts[LATENCY_SKETCH_BUCKETS];
+} LatencySketch;
+
+static inline int LatencySketchBucket(int64 value)
+{
+    if (value < LATENCY_SKETCH_SUB_BUCKETS) {
+        return (value < 0) ? 0 : (int)value;
+    }
+
+    int exp = 63 - __builtin_clzll((uint64)value);
+    if (exp > LATENCY_SKETCH_MAX_EXP) {
+        return LATENCY_SKETCH_BUCKETS - 1;
+    }
+    int sub = (int)((uint64)value >> (exp - LATENCY_SKETCH_SUB_BITS)) & (LATENCY_SKETCH_SUB_BUCKETS - 1);
+    return (exp - LATENCY_SKETCH_SUB_BITS + 1) * LATENCY_SKETCH_SUB_BUCKETS + sub;
+}
+
+/* lock free, may be called concurrently by any number of backends */
+static inline void LatencySketchAdd(LatencySketch* sketch, int64 value)
+{
+    (void)pg_atomic_fetch_add_u32(&sketch->counts[LatencySketchBucket(value)], 1);
+}
+
+extern void LatencySketchReset(LatencySketch* sketch);
+extern void LatencySketchMerge(LatencySketch* dst, const LatencySketch* src);
+extern void LatencySketchMoveTo(LatencySketch* src, LatencySketch* dst);
+extern int64 LatencySketchQuantile(const LatencySketch* sketch, double quantile);
+
+#endif /* LATENCY_SKETCH_H */
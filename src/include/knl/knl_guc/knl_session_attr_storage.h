@@ -65,6 +65,7 @@ typedef struct knl_session_attr_storage {
     bool enable_data_replicate;
     bool HaModuleDebug;
     bool hot_standby_feedback;
+    bool wal_receiver_compression;
     bool enable_stream_replication;
     bool EnforceTwoPhaseCommit;
     bool guc_most_available_sync;
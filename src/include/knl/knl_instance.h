@@ -211,6 +211,7 @@ typedef struct knl_g_stat_context {
     volatile bool force_process;
     int64 RTPERCENTILE[NUM_PERCENTILE_COUNT];
     struct SqlRTInfoArray* sql_rt_info_array;
+    struct LatencySketch* rt_sketch; /* response times of a single node since the last calculation */
     MemoryContext InstrPercentileContext;
 
     /* Set at the following cases:
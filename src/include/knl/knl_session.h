@@ -2286,6 +2286,12 @@ typedef struct knl_session_context {
     Dlelem elem;
 
     ThreadId attachPid;
+    /* thread pool group whose listener owns this session, workers of other groups may serve it */
+    class ThreadPoolGroup* group;
+    /* set when the session is queued for a worker, kept with the fields above used at every switch */
+    instr_time last_access_time;
+    /* stamp of the last detach, see ThreadPoolWorker::AttachSessionToThread */
+    uint64 detachStamp;
 
     MemoryContext top_mem_cxt;
     MemoryContext cache_mem_cxt;
@@ -2378,8 +2384,6 @@ typedef struct knl_session_context {
     knl_u_gtt_context gtt_ctx;
     /* extension streaming */
     knl_u_streaming_context streaming_cxt;
-
-    instr_time last_access_time;
 } knl_session_context;
 
 enum stp_xact_err_type {
@@ -1897,6 +1897,8 @@ typedef struct knl_t_libpq_context {
     int PqRecvLength;
     /* Message status */
     bool PqCommBusy;
+    /* ReadyForQuery flushes left pending in PqSendBuffer for a pipelining client */
+    int PqDeferredFlushes;
     bool DoingCopyOut;
 #ifdef HAVE_SIGPROCMASK
     sigset_t UnBlockSig, BlockSig, StartupBlockSig;
@@ -1937,6 +1939,11 @@ typedef struct knl_t_basebackup_context {
     char g_xlog_location[MAXPGPATH];
 
     char* buf_block;
+
+    /* LZ4 compress each CopyData message of the tar stream (BASE_BACKUP COMPRESS) */
+    bool compress;
+    char* compress_buf;
+    int compress_buf_size;
 } knl_t_basebackup_context;
 
 typedef struct knl_t_datarcvwriter_context {
@@ -2087,6 +2094,11 @@ typedef struct knl_t_walreceiver_context {
     bool AmWalReceiverForFailover;
     bool AmWalReceiverForStandby;
     int control_file_writed;
+    /* decompression of a compressed WAL stream, see WAL_COMPRESS_DICT_SIZE */
+    char* wal_decompress_buf;
+    int wal_decompress_buf_size;
+    char* wal_decompress_dict;
+    int wal_decompress_dict_len;
 } knl_t_walreceiver_context;
 
 typedef struct knl_t_walsender_context {
@@ -2103,6 +2115,8 @@ typedef struct knl_t_walsender_context {
     /* State for WalSndWakeupRequest */
     bool wake_wal_senders;
     bool wal_send_completed;
+    /* a standby reply was processed and sync rep waiters may be released */
+    bool sync_release_pending;
     /*
      * These variables are used similarly to openLogFile/Id/Seg/Off,
      * but for walsender to read the XLOG.
@@ -2140,6 +2154,19 @@ typedef struct knl_t_walsender_context {
      */
     char* output_xlog_message;
     Size output_xlog_msg_prefix_len;
+    /*
+     * Compression of the physical WAL stream, requested by the standby with
+     * START_REPLICATION ... COMPRESS. wal_compress_stream is an LZ4_stream_t.
+     */
+    bool wal_compress;
+    void* wal_compress_stream;
+    char* wal_compress_buf;
+    int wal_compress_buf_size;
+    char* wal_compress_dict;
+    int wal_compress_dict_len;
+    uint64 wal_compress_raw_bytes;
+    uint64 wal_compress_sent_bytes;
+    uint64 wal_compress_time_us;
     /*
      * Buffer for constructing outgoing messages
      * (sizeof(DataElementHeaderData) + MAX_SEND_SIZE bytes)
@@ -61,6 +61,9 @@ extern int pq_flush(void);
 extern int pq_flush_if_writable(void);
 extern void pq_flush_timedwait(int timeout);
 extern bool pq_is_send_pending(void);
+extern bool pq_has_pipelined_sync(void);
+extern bool pq_defer_flush(void);
+extern void pq_flush_deferred(void);
 extern int pq_putmessage(char msgtype, const char* s, size_t len);
 extern int pq_putmessage_noblock(char msgtype, const char* s, size_t len);
 extern void pq_startcopyout(void);
@@ -54,6 +54,8 @@ extern const uint32 ML_OPT_MODEL_VERSION_NUM;
 extern const uint32 RANGE_LIST_DISTRIBUTION_VERSION_NUM;
 extern const uint32 FIX_SQL_ADD_RELATION_REF_COUNT;
 extern const uint32 GENERATED_COL_VERSION_NUM;
+extern const uint32 GPC_STATUS_STATS_VERSION_NUM;
+extern const uint32 UNIQUE_SQL_PERCENTILE_VERSION_NUM;
 
 #define INPLACE_UPGRADE_PRECOMMIT_VERSION 1
 
@@ -608,6 +608,7 @@ typedef struct EState {
     /* true if we don't apply early-free-consumer mechanisim, especially for subplan */
     bool es_skip_early_deinit_consumer; 
     bool es_under_subplan;              /* true if operator is under a subplan */
+    int es_under_rescan_inner;          /* > 0 while initializing the inner side of a nestloop or recursive union */
     List* es_material_of_subplan;       /* List of Materialize operator of subplan */
     bool es_recursive_next_iteration;   /* true if under recursive-stream and need to rescan. */
 
@@ -1555,6 +1556,9 @@ typedef struct ScanState {
     int part_id;
     int startPartitionId;            /* start partition id for parallel threads. */
     int endPartitionId;              /* end partition id for parallel threads. */
+    int parallelScanNo;              /* scans started by a parallel seq scan, keys its morsel cursor. */
+    Oid parallelScanRelid;           /* relation of the morsel cursor held, InvalidOid if none. */
+    bool parallelScanMorsel;         /* smp workers may share morsel cursors, the scan is never rescanned per row. */
     RangeScanInRedis rangeScanInRedis;         /* if it is a range scan in redistribution time */
     bool isSampleScan;               /* identify is it table sample scan or not. */
     SampleScanParams sampleScanInfo; /* TABLESAMPLE params include type/seed/repeatable. */
@@ -2461,12 +2465,12 @@ typedef struct GroupingIdExprState {
 /*
  * record the first tuple time used by INSERT, UPDATE and DELETE in ExecModifyTable and ExecVecModifyTable
  */
-#define record_first_time()                                     \
-    do {                                                        \
-        if (unlikely(is_first_modified)) {                      \
-            INSTR_TIME_SET_CURRENT(node->first_tuple_modified); \
-            is_first_modified = false;                          \
-        }                                                       \
+#define record_first_time()                                         \
+    do {                                                            \
+        if (unlikely(is_first_modified)) {                          \
+            INSTR_TIME_SET_CYCLE_CLOCK(node->first_tuple_modified); \
+            is_first_modified = false;                              \
+        }                                                           \
     } while (0)
 
 extern TupleTableSlot* ExecMakeTupleSlot(Tuple tuple, TableScanDesc tableScan, TupleTableSlot* slot, TableAmType tableAm);
@@ -279,9 +279,7 @@ public:
 
     void InitGlobals();
 private:
-    void refreshParameterIfNecessary();
-
-    struct InsertFusionGlobalVariable {
+    struct InsertFusionRowTarget {
         /* for func/op expr calculation */
         FuncExprInfo* m_targetFuncNodes;
         
@@ -289,10 +287,25 @@ private:
         
         int m_targetParamNum;
 
+        ParamLoc* m_targetParamLoc;
+
         int m_targetConstNum;
 
         ConstLoc* m_targetConstLoc;
     };
+
+    void InitRowTarget(InsertFusionRowTarget* row, List* targetList, List* values, Index valuesRelid);
+
+    void refreshParameterIfNecessary(const InsertFusionRowTarget* row);
+
+    bool executeMultiRows(Relation rel, ResultRelInfo* result_rel_info, char* completionTag);
+
+    struct InsertFusionGlobalVariable {
+        /* one target per row, more than one only for INSERT ... VALUES (...), (...) */
+        InsertFusionRowTarget* m_rows;
+
+        int m_rowNum;
+    };
     InsertFusionGlobalVariable* m_c_global;
 
     struct InsertFusionLocaleVariable {
@@ -118,6 +118,9 @@ enum FusionDebug {
 
 const int MAX_OP_FUNCTION_NUM = 2;
 
+/* max rows of INSERT ... VALUES handled by InsertFusion, each row keeps its own targets in the fusion object */
+const int MAX_FUSION_INSERT_ROWS = 1000;
+
 typedef struct FuncExprInfo {
     AttrNumber resno;
     Oid funcid;
@@ -17,6 +17,7 @@
 #include "libpq/pqcomm.h"
 #include "mb/pg_wchar.h"
 #include "portability/instr_time.h"
+#include "utils/cycle_clock.h"
 #include "storage/barrier.h"
 #include "utils/hsearch.h"
 #include "utils/relcache.h"
@@ -1200,6 +1201,7 @@ typedef struct PgBackendStatus {
     int st_waitnode_count;              /* count of waiting nodes */
     int st_nodeid;                      /* maybe for nodeoid/nodeidx */
     int st_plannodeid;                  /* indentify which consumer is receiving data for SCTP */
+    volatile int st_exec_plannodeid;    /* plan node being executed, sampled by ASP */
     int st_numnodes;                    /* nodes number when reporting waitstatus in case it changed */
     uint32 st_waitevent;                /* backend's wait event */
     int st_stmtmem;                     /* statment mem for query */
@@ -1459,10 +1461,10 @@ static inline WaitState pgstat_report_waitstatus(WaitState waitstatus, bool isOn
     }
 
     if (u_sess->attr.attr_common.enable_instr_track_wait && (int)waitstatus != (int)STATE_WAIT_UNDEFINED) {
-        beentry->waitInfo.status_info.start_time = GetCurrentTimestamp();
+        beentry->waitInfo.status_info.start_time = GetCycleClockUsec();
     } else if (u_sess->attr.attr_common.enable_instr_track_wait &&
                (uint32)oldwaitstatus != (uint32)STATE_WAIT_UNDEFINED && waitstatus == STATE_WAIT_UNDEFINED) {
-        int64 duration = GetCurrentTimestamp() - beentry->waitInfo.status_info.start_time;
+        int64 duration = GetCycleClockUsec() - beentry->waitInfo.status_info.start_time;
         UpdateWaitStatusStat(&beentry->waitInfo, (uint32)oldwaitstatus, duration);
         beentry->waitInfo.status_info.start_time = 0;
     }
@@ -1488,7 +1490,7 @@ static inline WaitState pgstat_report_waitstatus_xid(WaitState waitstatus, uint6
         return oldStatus;
 
     if (u_sess->attr.attr_common.enable_instr_track_wait && (int)waitstatus != (int)STATE_WAIT_UNDEFINED)
-        beentry->waitInfo.status_info.start_time = GetCurrentTimestamp();
+        beentry->waitInfo.status_info.start_time = GetCycleClockUsec();
 
     /*
      * Since this is a single-byte field in a struct that only this process
@@ -1524,7 +1526,7 @@ static inline WaitState pgstat_report_waitstatus_relname(WaitState waitstatus, c
     }
 
     if (u_sess->attr.attr_common.enable_instr_track_wait && (int)waitstatus != (int)STATE_WAIT_UNDEFINED)
-        beentry->waitInfo.status_info.start_time = GetCurrentTimestamp();
+        beentry->waitInfo.status_info.start_time = GetCycleClockUsec();
 
     /*
      * Since this is a single-byte field in a struct that only this process
@@ -1561,7 +1563,7 @@ static inline WaitState pgstat_report_waitstatus_comm(WaitState waitstatus, int
         return oldStatus;
 
     if (u_sess->attr.attr_common.enable_instr_track_wait && (int)waitstatus != (int)STATE_WAIT_UNDEFINED)
-        beentry->waitInfo.status_info.start_time = GetCurrentTimestamp();
+        beentry->waitInfo.status_info.start_time = GetCycleClockUsec();
 
     /*
      * Since this is a single-byte field in a struct that only this process
@@ -1577,6 +1579,23 @@ static inline WaitState pgstat_report_waitstatus_comm(WaitState waitstatus, int
     return oldStatus;
 }
 
+/*
+ * Publish the plan node the thread is executing, so ASP samples can be charged to
+ * operators. Returns the previous node, which the caller restores when the node returns.
+ * This is a plain store into our own entry and must stay that cheap, it runs per tuple.
+ */
+static inline int pgstat_report_exec_plannode(int plannodeid)
+{
+    volatile PgBackendStatus* beentry = t_thrd.shemem_ptr_cxt.MyBEEntry;
+
+    if (beentry == NULL)
+        return -1;
+
+    int oldPlanNodeId = beentry->st_exec_plannodeid;
+    beentry->st_exec_plannodeid = plannodeid;
+    return oldPlanNodeId;
+}
+
 /*
  * For wait status which needs to focus its phase, update phase info and return the last wait phase.
  * Note. when isOnlyFetch is flaged true, only fetch last phase.
@@ -1643,10 +1662,10 @@ static inline void pgstat_report_waitevent(uint32 wait_event_info)
     beentry->st_waitevent = wait_event_info;
 
     if (u_sess->attr.attr_common.enable_instr_track_wait && wait_event_info != WAIT_EVENT_END) {
-        beentry->waitInfo.event_info.start_time = GetCurrentTimestamp();
+        beentry->waitInfo.event_info.start_time = GetCycleClockUsec();
     } else if (u_sess->attr.attr_common.enable_instr_track_wait && old_wait_event_info != WAIT_EVENT_END &&
                wait_event_info == WAIT_EVENT_END) {
-        int64 duration = GetCurrentTimestamp() - beentry->waitInfo.event_info.start_time;
+        int64 duration = GetCycleClockUsec() - beentry->waitInfo.event_info.start_time;
         UpdateWaitEventStat(&beentry->waitInfo, old_wait_event_info, duration);
         beentry->waitInfo.event_info.start_time = 0;
         beentry->waitInfo.event_info.duration = duration;
@@ -2068,19 +2087,19 @@ typedef struct SessionTimeEntry {
 #define PGSTAT_START_TIME_RECORD()                    \
     do {                                              \
         if (t_thrd.shemem_ptr_cxt.mySessionTimeEntry) \
-            startTime = GetCurrentTimestamp();        \
+            startTime = GetCycleClockUsec();          \
     } while (0)
 
 #define PGSTAT_END_TIME_RECORD(stage)                                                        \
     do {                                                                                     \
         if (t_thrd.shemem_ptr_cxt.mySessionTimeEntry)                                        \
-            u_sess->stat_cxt.localTimeInfoArray[stage] += GetCurrentTimestamp() - startTime; \
+            u_sess->stat_cxt.localTimeInfoArray[stage] += GetCycleClockUsec() - startTime;   \
     } while (0)
 
 #define PGSTAT_START_PLSQL_TIME_RECORD()                                                    \
     do {                                                                                    \
         if (u_sess->stat_cxt.isTopLevelPlSql && t_thrd.shemem_ptr_cxt.mySessionTimeEntry) { \
-            startTime = GetCurrentTimestamp();                                              \
+            startTime = GetCycleClockUsec();                                                \
             u_sess->stat_cxt.isTopLevelPlSql = false;                                       \
             needRecord = true;                                                              \
         }                                                                                   \
@@ -2089,7 +2108,7 @@ typedef struct SessionTimeEntry {
 #define PGSTAT_END_PLSQL_TIME_RECORD(stage)                                                  \
     do {                                                                                     \
         if (needRecord == true && t_thrd.shemem_ptr_cxt.mySessionTimeEntry) {                \
-            u_sess->stat_cxt.localTimeInfoArray[stage] += GetCurrentTimestamp() - startTime; \
+            u_sess->stat_cxt.localTimeInfoArray[stage] += GetCycleClockUsec() - startTime;   \
             u_sess->stat_cxt.isTopLevelPlSql = true;                                         \
         }                                                                                    \
     } while (0)
@@ -2507,7 +2526,7 @@ typedef enum NetInfoType {
 #define END_NET_SEND_INFO(str_len)                                                              \
     do {                                                                                        \
         if (str_len > 0 && t_thrd.shemem_ptr_cxt.mySessionTimeEntry) {                          \
-            u_sess->stat_cxt.localNetInfo[NET_SEND_TIMES] += GetCurrentTimestamp() - startTime; \
+            u_sess->stat_cxt.localNetInfo[NET_SEND_TIMES] += GetCycleClockUsec() - startTime;   \
             u_sess->stat_cxt.localNetInfo[NET_SEND_N_CALLS]++;                                  \
             u_sess->stat_cxt.localNetInfo[NET_SEND_SIZE] += str_len;                            \
         }                                                                                       \
@@ -2516,7 +2535,7 @@ typedef enum NetInfoType {
 #define END_NET_STREAM_SEND_INFO(str_len)                                                              \
     do {                                                                                               \
         if (str_len > 0 && t_thrd.shemem_ptr_cxt.mySessionTimeEntry) {                                 \
-            u_sess->stat_cxt.localNetInfo[NET_STREAM_SEND_TIMES] += GetCurrentTimestamp() - startTime; \
+            u_sess->stat_cxt.localNetInfo[NET_STREAM_SEND_TIMES] += GetCycleClockUsec() - startTime;   \
             u_sess->stat_cxt.localNetInfo[NET_STREAM_SEND_N_CALLS]++;                                  \
             u_sess->stat_cxt.localNetInfo[NET_STREAM_SEND_SIZE] += str_len;                            \
         }                                                                                              \
@@ -2525,7 +2544,7 @@ typedef enum NetInfoType {
 #define END_NET_RECV_INFO(str_len)                                                              \
     do {                                                                                        \
         if (str_len > 0 && t_thrd.shemem_ptr_cxt.mySessionTimeEntry) {                          \
-            u_sess->stat_cxt.localNetInfo[NET_RECV_TIMES] += GetCurrentTimestamp() - startTime; \
+            u_sess->stat_cxt.localNetInfo[NET_RECV_TIMES] += GetCycleClockUsec() - startTime;   \
             u_sess->stat_cxt.localNetInfo[NET_RECV_N_CALLS]++;                                  \
             u_sess->stat_cxt.localNetInfo[NET_RECV_SIZE] += str_len;                            \
         }                                                                                       \
@@ -2534,7 +2553,7 @@ typedef enum NetInfoType {
 #define END_NET_STREAM_RECV_INFO(str_len)                                                              \
     do {                                                                                               \
         if (str_len > 0 && t_thrd.shemem_ptr_cxt.mySessionTimeEntry) {                                 \
-            u_sess->stat_cxt.localNetInfo[NET_STREAM_RECV_TIMES] += GetCurrentTimestamp() - startTime; \
+            u_sess->stat_cxt.localNetInfo[NET_STREAM_RECV_TIMES] += GetCycleClockUsec() - startTime;   \
             u_sess->stat_cxt.localNetInfo[NET_STREAM_RECV_N_CALLS]++;                                  \
             u_sess->stat_cxt.localNetInfo[NET_STREAM_RECV_SIZE] += str_len;                            \
         }                                                                                              \
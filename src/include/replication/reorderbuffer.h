@@ -340,6 +340,10 @@ struct ReorderBuffer {
     /* buffer for disk<->memory conversions */
     char* outbuf;
     Size outbufsize;
+
+    /* buffer batching serialized changes into few writes to the spill file */
+    char* spillbuf;
+    Size spillbuflen;
 };
 
 ReorderBuffer* ReorderBufferAllocate(void);
@@ -110,6 +110,16 @@ typedef struct {
     bool catchup;
 } WalDataMessageHeader;
 
+/*
+ * A compressed WAL data message (message type 'z') is sent instead of 'w' when
+ * the standby asked for it with START_REPLICATION ... COMPRESS. It carries a
+ * WalDataMessageHeader, the uint32 length of the uncompressed WAL, then the LZ4
+ * compressed WAL. Each message is compressed with the last WAL_COMPRESS_DICT_SIZE
+ * bytes of WAL shipped in earlier 'z' messages as dictionary, so both ends keep
+ * that window and update it with WalCompressUpdateDict() after every 'z' message.
+ */
+#define WAL_COMPRESS_DICT_SIZE (64 * 1024)
+
 /*
  * Header for a data replication message (message type 'd').  This is wrapped within
  * a CopyData message at the FE/BE protocol level.
@@ -59,6 +59,7 @@ extern void IdentifyMode(void);
 extern bool WalSndAllInProgress(int type);
 extern bool WalSndQuorumInProgress(int type);
 extern XLogSegNo WalGetSyncCountWindow(void);
+extern void WalCompressUpdateDict(char* dict, int* dictLen, const char* data, Size len);
 
 /*
  * Remember that we want to wakeup walsenders later
@@ -94,6 +94,8 @@ public:
     }
 	
 	void BindThreadToAllAvailCpu(ThreadId thread) const;
+    knl_session_context* StealSession(ThreadPoolGroup* thief);
+    bool HandOffSession(ThreadPoolGroup* home, knl_session_context* session);
 
 private:
     ThreadPoolGroup* FindThreadGroupWithLeastSession();
@@ -109,6 +111,7 @@ private:
     void ConstrainThreadNum();
     void GetInstanceBind();
     bool CheckCpuBind() const;
+    void InitStealThreshold(bool bindCpu);
 
 private:
     MemoryContext m_threadPoolContext;
@@ -120,6 +123,13 @@ private:
     int m_groupNum;
     int m_threadNum;
     int m_maxPoolSize;
+    /*
+     * m_stealThreshold[thief * m_groupNum + victim] is the minimal number of sessions waiting
+     * in the victim group before a worker of the thief group may serve them. It grows with
+     * the NUMA distance between the two groups.
+     */
+    int* m_stealThreshold;
+    volatile uint32 m_stealCursor;
 };
 
 #endif /* THREAD_POOL_CONTROLER_H */
@@ -87,6 +87,12 @@ public:
     float4 GetSessionPerThread();
     void GetThreadPoolGroupStat(ThreadPoolStat* stat);
     bool IsGroupHang();
+    void RecordQueueWait(const instr_time* enqueueTime);
+
+    inline int GetWaitServeSessionCount()
+    {
+        return m_waitServeSessionCount;
+    }
 
     inline ThreadPoolListener* GetListener()
     {
@@ -126,6 +132,7 @@ public:
     friend class ThreadPoolWorker;
     friend class ThreadPoolListener;
     friend class ThreadPoolScheduler;
+    friend class ThreadPoolControler;
 
 private:
     void AttachThreadToCPU(ThreadId thread, int cpu);
@@ -146,6 +153,13 @@ private:
     volatile int m_waitServeSessionCount;  // wait for worker to server
     volatile int m_processTaskCount;
 
+    /* ready queue latency and cross group balancing statistics */
+    volatile uint64 m_queueWaitCount;
+    volatile uint64 m_queueWaitTotalUs;
+    volatile uint64 m_queueWaitMaxUs;
+    volatile uint64 m_stealInCount;   /* sessions of other groups served by our workers */
+    volatile uint64 m_stealOutCount;  /* our sessions served by workers of other groups */
+
     int m_groupId;
     int m_numaId;
     int m_groupCpuNum;
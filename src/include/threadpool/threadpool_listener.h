@@ -51,6 +51,8 @@ public:
     void ReaperAllSession();
     void ShutDown() const;
     bool GetSessIshang(instr_time* current_time, uint64* sessionId);
+    knl_session_context* StealReadySession();
+    bool TryHandOffSession(knl_session_context* session);
 
     inline ThreadPoolGroup* GetGroup()
     {
@@ -135,6 +135,8 @@ private:
     ThreadId m_tid;
     uint m_idx;
     knl_session_context* m_currentSession;
+    /* detach stamp of the session whose thread local variables are still loaded, 0 if none */
+    uint64 m_lastDetachStamp;
     volatile ThreadStatus m_threadStatus;
     ThreadStayReason m_reason;
     Dlelem m_elem;
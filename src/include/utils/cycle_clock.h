@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020 Huawei Technologies Co.,Ltd.
+ *
+ * openGauss is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *          http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * ---------------------------------------------------------------------------------------
+ *
+ * cycle_clock.h
+ *     Cheap monotonic clock for instrumentation.
+ *
+ * Wait events, statement phases and plan node timers take two readings per
+ * measurement, often millions of times per second, so they read the CPU cycle
+ * counter instead of calling into the kernel. The counter is only used when it
+ * runs at a constant rate on all cores (invariant TSC on x86, the generic timer
+ * on ARM) and it could be calibrated at startup; otherwise the clock falls back
+ * to CLOCK_MONOTONIC.
+ *
+ * Readings are microseconds from an unspecified origin: they are only good for
+ * computing durations, never compare them with timestamps.
+ *
+ * IDENTIFICATION
+ *        src/include/utils/cycle_clock.h
+ *
+ * ---------------------------------------------------------------------------------------
+ */
+
+#ifndef CYCLE_CLOCK_H
+#define CYCLE_CLOCK_H
+
+#include <time.h>
+#include "portability/instr_time.h"
+
+/* set once by InitCycleClock() before any other thread is started */
+extern bool g_cycle_clock_usable;
+extern double g_cycle_clock_usec_per_cycle;
+
+extern void InitCycleClock(void);
+
+static inline uint64 ReadCycleCounter(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    uint32 low, high;
+    __asm__ __volatile__("rdtsc" : "=a"(low), "=d"(high));
+    return ((uint64)high << 32) | low;
+#elif defined(__aarch64__)
+    uint64 cval;
+    __asm__ __volatile__("isb; mrs %0, cntvct_el0" : "=r"(cval) : : "memory");
+    return cval;
+#else
+    return 0;
+#endif
+}
+
+/* current reading of the clock, in microseconds */
+static inline int64 GetCycleClockUsec(void)
+{
+    if (likely(g_cycle_clock_usable)) {
+        return (int64)((double)ReadCycleCounter() * g_cycle_clock_usec_per_cycle);
+    }
+
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/*
+ * INSTR_TIME_SET_CURRENT on the cycle clock. Both ends of an interval must be
+ * taken with the same macro.
+ */
+#define INSTR_TIME_SET_CYCLE_CLOCK(t)           \
+    do {                                        \
+        int64 __usec = GetCycleClockUsec();     \
+        (t).tv_sec = __usec / 1000000;          \
+        (t).tv_usec = __usec % 1000000;         \
+    } while (0)
+
+#endif /* CYCLE_CLOCK_H */
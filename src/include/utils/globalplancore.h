@@ -144,7 +144,8 @@ typedef struct GPCVal
 {
     CachedPlanSource*  plansource;
     instr_time  last_use_time;
-    volatile uint32 used_count; /* fetched times */
+    volatile uint32 used_count; /* fetched times since last clean up round */
+    volatile uint64 hit_count;  /* fetched times since stored */
 } GPCVal;
 
 typedef struct GPCEntry
@@ -167,6 +168,8 @@ typedef struct GPCViewStatus
     char *schema_name;
     int params_num;
     Oid func_id;
+    uint64 hit_count;
+    double plan_time;
 } GPCViewStatus;
 
 
@@ -203,6 +206,7 @@ extern Datum GPCPlanClean(PG_FUNCTION_ARGS);
 extern void GPCResetAll();
 void GPCCleanDatanodeStatement(int dn_stmt_num, const char* stmt_name);
 void GPCReGplan(CachedPlanSource* plansource);
+void GPCDestroyPlanSource(CachedPlanSource* plansource);
 void CNGPCCleanUpSession();
 List* CopyLocalStmt(const List* stmt_list, const MemoryContext parent_cxt, MemoryContext* plan_context);
 bool SPIParseEnableGPC(const Node *node);
@@ -208,6 +208,7 @@ typedef struct GPCSource
 {
     GPCPlanStatus status;
     struct GPCKey*  key;   //remember when we generate the plan.
+    double plan_time;      /* time spent on building the generic plan, in ms */
 } GPCSource;
 
 typedef struct SPISign
@@ -197,6 +197,7 @@ typedef void (*assembleBatchFun)(VecStreamState* vsstate, VectorBatch* batch);
 
 typedef struct VecStreamState : public StreamState {
     VectorBatch* m_CurrentBatch;
+    bool m_sharedBatch; /* m_CurrentBatch is owned by the local stream shared context */
     assembleBatchFun batchForm;
     bool redistribute;
     int bitNumericLen;
@@ -451,6 +451,8 @@ public:
 
     void CopyNth(VectorBatch* batchSrc, int Nth);
 
+    void CopyNthRows(VectorBatch* batchSrc, const int* rows, int nrows);
+
 public:
     /* Pack template function. */
     template <bool copyMatch, bool hasSysCol>
@@ -0,0 +1,47 @@
+#!/bin/sh
+
+source ./util.sh
+
+function test_1()
+{
+  set_default
+  check_instance_multi_standby
+
+  echo "restart datanode1_standby with wal_receiver_compression = on"
+  kill_standby
+  gs_guc set -Z datanode -D $standby_data_dir -c "wal_receiver_compression = on"
+  start_standby
+  check_replication_setup
+
+  gsql -d $db -p $dn1_primary_port -c "DROP TABLE if exists wal_compress_t1; create table wal_compress_t1(id int, pad text);"
+  gsql -d $db -p $dn1_primary_port -c "insert into wal_compress_t1 select i, repeat('wal', 50) from generate_series(1, 100000) i;"
+  wait_catchup_finish
+  sleep 2
+
+  #the rows must have been replayed from the compressed stream
+  if [ $(gsql -d $db -p $dn1_standby_port -m -c "select count(1) from wal_compress_t1;" | grep 100000 | wc -l) -eq 1 ]; then
+    echo "compressed stream replayed on datanode1_standby"
+  else
+    echo "compressed stream replay $failed_keyword on datanode1_standby"
+    exit 1
+  fi
+
+  #the walsender logs its compression totals when the standby goes away
+  kill_standby
+  if [ $(grep -r "WAL stream compression: [0-9]* bytes of WAL sent as [0-9]* bytes" $primary_data_dir/pg_log | wc -l) -gt 0 ]; then
+    echo "walsender compressed the stream"
+  else
+    echo "walsender did not compress the stream $failed_keyword"
+    exit 1
+  fi
+}
+
+function tear_down() {
+  sleep 1
+  gs_guc set -Z datanode -D $standby_data_dir -c "wal_receiver_compression = off"
+  start_standby
+  gsql -d $db -p $dn1_primary_port -c "DROP TABLE if exists wal_compress_t1;"
+}
+
+test_1
+tear_down
@@ -0,0 +1,55 @@
+--
+-- multi-row insert bypass
+--
+set enable_opfusion=on;
+
+drop table if exists test_bypass_multirow;
+drop table if exists test_bypass_multirow_lsn;
+create table test_bypass_multirow(col1 int, col2 text);
+create table test_bypass_multirow_lsn(lsn text);
+
+-- the rows must be WAL-logged even though the table has no index
+insert into test_bypass_multirow_lsn select pg_current_xlog_insert_location();
+insert into test_bypass_multirow values
+    (1, repeat('x', 1000)),
+    (2, repeat('x', 1000)),
+    (3, repeat('x', 1000)),
+    (4, repeat('x', 1000)),
+    (5, repeat('x', 1000)),
+    (6, repeat('x', 1000)),
+    (7, repeat('x', 1000)),
+    (8, repeat('x', 1000)),
+    (9, repeat('x', 1000)),
+    (10, repeat('x', 1000));
+select pg_xlog_location_diff(pg_current_xlog_insert_location(), lsn) > 10000 as logged from test_bypass_multirow_lsn;
+select count(*), sum(length(col2)) from test_bypass_multirow;
+
+-- the plan shows the multi-row insert as bypassed, also with an index
+create index itest_bypass_multirow on test_bypass_multirow(col1);
+explain (costs off) insert into test_bypass_multirow values (11, 'a'), (12, 'b'), (13, 'c');
+insert into test_bypass_multirow values (11, 'a'), (12, 'b'), (13, 'c');
+set enable_seqscan = off;
+select col1, col2 from test_bypass_multirow where col1 > 10 order by col1;
+reset enable_seqscan;
+
+-- a table with a trigger is never bypassed, the trigger must fire for every row
+create table test_bypass_multirow_trig(col1 int, col2 int);
+create or replace function tri_bypass_multirow() returns trigger as $$
+begin
+    NEW.col2 = NEW.col2 * 10;
+    return NEW;
+end;
+$$ language plpgsql;
+create trigger tri_bypass_multirow before insert on test_bypass_multirow_trig
+    for each row execute procedure tri_bypass_multirow();
+set opfusion_debug_mode = 'log';
+explain (costs off) insert into test_bypass_multirow_trig values (1, 1), (2, 2);
+set opfusion_debug_mode = off;
+insert into test_bypass_multirow_trig values (1, 1), (2, 2);
+select * from test_bypass_multirow_trig order by col1;
+
+drop table test_bypass_multirow_trig;
+drop function tri_bypass_multirow();
+
+drop table test_bypass_multirow;
+drop table test_bypass_multirow_lsn;
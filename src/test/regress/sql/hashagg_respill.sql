@@ -0,0 +1,25 @@
+-- row hash agg respilling temp files that still do not fit in work_mem
+drop table if exists hashagg_respill_t;
+create table hashagg_respill_t(a int);
+insert into hashagg_respill_t select generate_series(1, 60000);
+
+set enable_sort = off;
+set work_mem = '64kB';
+-- the planner expects 200 groups for the expression, each temp file then holds far more groups than fit in memory
+explain (costs off) select count(*) as ngroups, sum(c) as nrows, min(c) as min_c, max(c) as max_c, sum(k) as sum_k
+    from (select a % 30000 as k, count(*) as c from hashagg_respill_t group by 1) s;
+select count(*) as ngroups, sum(c) as nrows, min(c) as min_c, max(c) as max_c, sum(k) as sum_k
+    from (select a % 30000 as k, count(*) as c from hashagg_respill_t group by 1) s;
+select count(*) as ngroups, sum(c) as nrows
+    from (select a % 7 as k, count(distinct a) as c from hashagg_respill_t group by 1) s;
+
+-- same groups without hash agg
+set enable_hashagg = off;
+set enable_sort = on;
+select count(*) as ngroups, sum(c) as nrows, min(c) as min_c, max(c) as max_c, sum(k) as sum_k
+    from (select a % 30000 as k, count(*) as c from hashagg_respill_t group by 1) s;
+
+reset enable_hashagg;
+reset enable_sort;
+reset work_mem;
+drop table hashagg_respill_t;
@@ -0,0 +1,36 @@
+--
+-- row hash join whose inner side is much larger than estimated
+--
+drop table if exists hashjoin_growth_outer;
+drop table if exists hashjoin_growth_inner;
+create table hashjoin_growth_outer(a int, b int);
+create table hashjoin_growth_inner(x int, y int, z int);
+insert into hashjoin_growth_outer select i, i from generate_series(1, 20000) i;
+insert into hashjoin_growth_inner select i, i, i from generate_series(1, 20000) i;
+analyze hashjoin_growth_outer;
+analyze hashjoin_growth_inner;
+
+set enable_nestloop = off;
+set enable_mergejoin = off;
+set enable_hashjoin = on;
+-- x and y are correlated, so the filter keeps 5000 rows where the planner expects a handful
+explain (costs off)
+select count(*) as nrows, sum(o.b) as sum_b, sum(i.z) as sum_z
+    from hashjoin_growth_outer o join hashjoin_growth_inner i on o.a = i.x
+    where i.x % 4 = 0 and i.y % 4 = 0;
+select count(*) as nrows, sum(o.b) as sum_b, sum(i.z) as sum_z
+    from hashjoin_growth_outer o join hashjoin_growth_inner i on o.a = i.x
+    where i.x % 4 = 0 and i.y % 4 = 0;
+
+-- the bucket array keeps its size once the table is split into batches
+set work_mem = '64kB';
+select count(*) as nrows, sum(o.b) as sum_b, sum(i.z) as sum_z
+    from hashjoin_growth_outer o join hashjoin_growth_inner i on o.a = i.x
+    where i.x % 4 = 0 and i.y % 4 = 0;
+
+reset work_mem;
+reset enable_nestloop;
+reset enable_mergejoin;
+reset enable_hashjoin;
+drop table hashjoin_growth_outer;
+drop table hashjoin_growth_inner;
@@ -0,0 +1,47 @@
+--
+-- smp seq scans rescanned per outer row must keep the static block split
+--
+create schema smp_rescan_morsel;
+set search_path=smp_rescan_morsel;
+
+create table t_outer(a int, b int);
+insert into t_outer select i, i % 50 from generate_series(1, 200) i;
+create table t_inner(a int, b int);
+insert into t_inner select i, i % 200 + 1 from generate_series(1, 20000) i;
+analyze t_outer;
+analyze t_inner;
+
+set enable_hashjoin=off;
+set enable_mergejoin=off;
+set enable_material=off;
+set enable_nestloop=on;
+
+-- reference results without smp
+set query_dop=1;
+create table r_join as
+    select o.a, count(*) as c, sum(i.a) as s from t_outer o join t_inner i on o.a = i.b and i.a > o.b group by o.a;
+create table r_sub as
+    select o.a, (select count(*) from t_inner i where i.b = o.a and i.a > o.b * 100) as c from t_outer o;
+
+set query_dop=2;
+select count(*) as groups, sum(c) as total from r_join;
+select count(*) as mismatches from (
+    (select o.a, count(*) as c, sum(i.a) as s from t_outer o join t_inner i on o.a = i.b and i.a > o.b group by o.a
+     except all select * from r_join)
+    union all
+    (select * from r_join
+     except all select o.a, count(*) as c, sum(i.a) as s from t_outer o join t_inner i on o.a = i.b and i.a > o.b group by o.a)) d;
+select count(*) as mismatches from (
+    (select o.a, (select count(*) from t_inner i where i.b = o.a and i.a > o.b * 100) as c from t_outer o
+     except all select * from r_sub)
+    union all
+    (select * from r_sub
+     except all select o.a, (select count(*) from t_inner i where i.b = o.a and i.a > o.b * 100) as c from t_outer o)) d;
+
+reset query_dop;
+reset enable_hashjoin;
+reset enable_mergejoin;
+reset enable_material;
+reset enable_nestloop;
+reset search_path;
+drop schema smp_rescan_morsel cascade;
@@ -0,0 +1,26 @@
+--
+-- session GUCs and random seed must follow the session across thread pool workers,
+-- run in parallel with threadpool_guc_isolation_2 so that sessions move between workers
+--
+drop table if exists tp_guc_rand_1;
+create table tp_guc_rand_1(r float8);
+set datestyle = 'SQL, DMY';
+set work_mem = '3MB';
+select count(*) as seeded from (select setseed(0.5)) s;
+insert into tp_guc_rand_1 select random();
+select count(*) as slept from (select pg_sleep(0.1)) s;
+select current_setting('datestyle') as datestyle;
+select current_setting('work_mem') as work_mem;
+select count(*) as slept from (select pg_sleep(0.1)) s;
+select current_setting('datestyle') as datestyle;
+select current_setting('work_mem') as work_mem;
+select count(*) as slept from (select pg_sleep(0.1)) s;
+select current_setting('datestyle') as datestyle;
+select current_setting('work_mem') as work_mem;
+select count(*) as seeded from (select setseed(0.5)) s;
+select count(*) as slept from (select pg_sleep(0.1)) s;
+insert into tp_guc_rand_1 select random();
+select count(*) as samples, count(distinct r) as distinct_values from tp_guc_rand_1;
+drop table tp_guc_rand_1;
+reset datestyle;
+reset work_mem;
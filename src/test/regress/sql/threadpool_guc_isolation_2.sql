@@ -0,0 +1,26 @@
+--
+-- session GUCs and random seed must follow the session across thread pool workers,
+-- run in parallel with threadpool_guc_isolation_1 so that sessions move between workers
+--
+drop table if exists tp_guc_rand_2;
+create table tp_guc_rand_2(r float8);
+set datestyle = 'German, DMY';
+set work_mem = '5MB';
+select count(*) as seeded from (select setseed(0.5)) s;
+insert into tp_guc_rand_2 select random();
+select count(*) as slept from (select pg_sleep(0.1)) s;
+select current_setting('datestyle') as datestyle;
+select current_setting('work_mem') as work_mem;
+select count(*) as slept from (select pg_sleep(0.1)) s;
+select current_setting('datestyle') as datestyle;
+select current_setting('work_mem') as work_mem;
+select count(*) as slept from (select pg_sleep(0.1)) s;
+select current_setting('datestyle') as datestyle;
+select current_setting('work_mem') as work_mem;
+select count(*) as seeded from (select setseed(0.5)) s;
+select count(*) as slept from (select pg_sleep(0.1)) s;
+insert into tp_guc_rand_2 select random();
+select count(*) as samples, count(distinct r) as distinct_values from tp_guc_rand_2;
+drop table tp_guc_rand_2;
+reset datestyle;
+reset work_mem;
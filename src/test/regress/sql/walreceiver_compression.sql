@@ -0,0 +1,5 @@
+-- wal_receiver_compression only takes effect when the configuration is reloaded, a session cannot change it
+select name, setting, boot_val, context from pg_settings where name = 'wal_receiver_compression';
+select set_config('wal_receiver_compression', 'on', false);
+reset wal_receiver_compression;
+select current_setting('wal_receiver_compression');